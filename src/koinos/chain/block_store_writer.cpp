@@ -0,0 +1,177 @@
+#include <koinos/chain/block_store_writer.hpp>
+
+#include <koinos/log.hpp>
+#include <koinos/rpc/block_store/block_store_rpc.pb.h>
+#include <koinos/util/conversion.hpp>
+#include <koinos/util/hex.hpp>
+
+#include <algorithm>
+#include <exception>
+
+namespace koinos::chain {
+
+block_store_writer::block_store_writer( submit_function submit,
+                                        std::size_t max_in_flight,
+                                        std::chrono::milliseconds initial_backoff ):
+    _submit( std::move( submit ) ),
+    _max_in_flight( std::max( max_in_flight, std::size_t( 1 ) ) ),
+    _initial_backoff( initial_backoff )
+{
+  _thread = std::thread(
+    [ this ]()
+    {
+      run();
+    } );
+}
+
+block_store_writer::~block_store_writer()
+{
+  stop();
+}
+
+void block_store_writer::add_block( const protocol::block& block, const protocol::block_receipt& receipt )
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _queue.size() < _max_in_flight;
+            } );
+
+  _queue.emplace_back( block, receipt );
+
+  lock.unlock();
+  _cv.notify_all();
+}
+
+void block_store_writer::flush()
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _queue.empty();
+            } );
+}
+
+void block_store_writer::stop()
+{
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+    _stopping = true;
+  }
+
+  _cv.notify_all();
+
+  if( _thread.joinable() )
+    _thread.join();
+}
+
+std::size_t block_store_writer::in_flight() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _queue.size();
+}
+
+block_store_stats block_store_writer::stats() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _stats;
+}
+
+void block_store_writer::run()
+{
+  while( true )
+  {
+    std::string request;
+    const protocol::block* block;
+
+    {
+      std::unique_lock< std::mutex > lock( _mutex );
+      _cv.wait( lock,
+                [ & ]()
+                {
+                  return _stopping || !_queue.empty();
+                } );
+
+      // Anything queued is stored before stopping so that no applied block is dropped
+      if( _queue.empty() )
+        return;
+
+      // The front of the queue stays in place until it has been stored
+      block = &_queue.front().first;
+
+      rpc::block_store::block_store_request req;
+      *req.mutable_add_block()->mutable_block_to_add()   = _queue.front().first;
+      *req.mutable_add_block()->mutable_receipt_to_add() = _queue.front().second;
+      request                                            = util::converter::as< std::string >( req );
+    }
+
+    auto backoff = _initial_backoff;
+
+    while( !store( *block, request ) )
+    {
+      std::unique_lock< std::mutex > lock( _mutex );
+      _stats.failures++;
+
+      if( _stopping )
+      {
+        LOG( error ) << "Dropping " << _queue.size() << " blocks that were not stored in block store, starting with "
+                     << util::to_hex( block->id() );
+        _stats.dropped += _queue.size();
+        _queue.clear();
+        lock.unlock();
+        _cv.notify_all();
+        return;
+      }
+
+      _cv.wait_for( lock,
+                    backoff,
+                    [ & ]()
+                    {
+                      return _stopping;
+                    } );
+      backoff = std::min( backoff * 2, max_backoff );
+    }
+
+    {
+      std::lock_guard< std::mutex > lock( _mutex );
+      _stats.stored++;
+      _queue.pop_front();
+    }
+
+    _cv.notify_all();
+  }
+}
+
+bool block_store_writer::store( const protocol::block& block, const std::string& request )
+{
+  try
+  {
+    rpc::block_store::block_store_response resp;
+    resp.ParseFromString( _submit( request ).get() );
+
+    if( resp.has_error() )
+    {
+      LOG( error ) << "Received error from block store for block " << util::to_hex( block.id() ) << ": "
+                   << resp.error().message();
+      return false;
+    }
+
+    if( !resp.has_add_block() )
+    {
+      LOG( error ) << "Unexpected response from block store for block " << util::to_hex( block.id() );
+      return false;
+    }
+
+    return true;
+  }
+  catch( const std::exception& e )
+  {
+    LOG( error ) << "Failed to store block " << util::to_hex( block.id() ) << " in block store: " << e.what();
+  }
+
+  return false;
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <koinos/protocol/protocol.pb.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace koinos::chain {
+
+struct block_store_stats
+{
+  uint64_t stored   = 0;
+  uint64_t failures = 0;
+  uint64_t dropped  = 0;
+};
+
+/**
+ * Persists applied blocks and their receipts to the block store off of the block path.
+ *
+ * Blocks are submitted one at a time in the order they were added, each after the previous one was
+ * acknowledged, so the block store always receives them in order. A failed submission is retried with
+ * exponential backoff and holds back the blocks behind it. At most max_in_flight blocks are pending at any
+ * time and add_block waits for room beyond that, so a block store that stays unavailable stalls block
+ * application instead of losing blocks.
+ *
+ * Because persistence happens behind block application, a block can be broadcast as accepted before the block
+ * store has it. Only blocks still failing when the writer is stopped are given up on. Failed submissions and
+ * dropped blocks are logged and counted in the stats.
+ */
+class block_store_writer final
+{
+public:
+  using submit_function = std::function< std::shared_future< std::string >( const std::string& ) >;
+
+  static constexpr std::size_t default_max_in_flight                 = 64;
+  static constexpr std::chrono::milliseconds default_initial_backoff = std::chrono::milliseconds( 100 );
+  static constexpr std::chrono::milliseconds max_backoff             = std::chrono::seconds( 10 );
+
+  block_store_writer( submit_function submit,
+                      std::size_t max_in_flight                 = default_max_in_flight,
+                      std::chrono::milliseconds initial_backoff = default_initial_backoff );
+  ~block_store_writer();
+
+  void add_block( const protocol::block& block, const protocol::block_receipt& receipt );
+
+  // Blocks until every block added so far has been stored or dropped
+  void flush();
+
+  // Stores what is pending, dropping the remaining blocks once a submission fails. Blocks added afterwards are
+  // never stored.
+  void stop();
+
+  std::size_t in_flight() const;
+  block_store_stats stats() const;
+
+private:
+  void run();
+  bool store( const protocol::block& block, const std::string& request );
+
+  submit_function _submit;
+  std::size_t _max_in_flight;
+  std::chrono::milliseconds _initial_backoff;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque< std::pair< protocol::block, protocol::block_receipt > > _queue;
+  block_store_stats _stats;
+  bool _stopping = false;
+
+  std::thread _thread;
+};
+
+} // namespace koinos::chain
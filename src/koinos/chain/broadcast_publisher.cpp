@@ -0,0 +1,214 @@
+#include <koinos/chain/broadcast_publisher.hpp>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <koinos/log.hpp>
+#include <koinos/util/base58.hpp>
+#include <koinos/util/conversion.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+
+namespace koinos::chain {
+
+namespace {
+
+constexpr std::size_t max_event_topic_prefixes = 4'096;
+
+} // namespace
+
+broadcast_publisher::broadcast_publisher( publish_function publish, bool batch_events, std::size_t max_queued ):
+    _publish( std::move( publish ) ),
+    _batch_events( batch_events ),
+    _max_queued( std::max( max_queued, std::size_t( 1 ) ) )
+{
+  _thread = std::thread(
+    [ this ]()
+    {
+      run();
+    } );
+}
+
+broadcast_publisher::~broadcast_publisher()
+{
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+    _stopping = true;
+  }
+
+  _cv.notify_all();
+  _thread.join();
+}
+
+void broadcast_publisher::publish_block( block_publication&& publication )
+{
+  enqueue( std::move( publication ) );
+}
+
+void broadcast_publisher::publish( std::string topic, std::string payload )
+{
+  enqueue( std::make_pair( std::move( topic ), std::move( payload ) ) );
+}
+
+void broadcast_publisher::flush()
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _queued == 0;
+            } );
+}
+
+void broadcast_publisher::enqueue( std::variant< block_publication, message >&& item )
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _queued < _max_queued;
+            } );
+
+  _queue.emplace_back( std::move( item ) );
+  _queued++;
+
+  lock.unlock();
+  _cv.notify_all();
+}
+
+void broadcast_publisher::run()
+{
+  while( true )
+  {
+    std::variant< block_publication, message > item;
+
+    {
+      std::unique_lock< std::mutex > lock( _mutex );
+      _cv.wait( lock,
+                [ & ]()
+                {
+                  return _stopping || !_queue.empty();
+                } );
+
+      // Anything queued is published before stopping
+      if( _queue.empty() )
+        return;
+
+      item = std::move( _queue.front() );
+      _queue.pop_front();
+    }
+
+    try
+    {
+      if( auto* publication = std::get_if< block_publication >( &item ); publication != nullptr )
+      {
+        publish_block_messages( *publication );
+      }
+      else
+      {
+        const auto& [ topic, payload ] = std::get< message >( item );
+        _publish( topic, payload );
+      }
+    }
+    catch( const std::exception& e )
+    {
+      LOG( error ) << "Failed to publish broadcast: " << e.what();
+    }
+
+    {
+      std::lock_guard< std::mutex > lock( _mutex );
+      _queued--;
+    }
+
+    _cv.notify_all();
+  }
+}
+
+void broadcast_publisher::publish_block_messages( const block_publication& publication )
+{
+  broadcast::block_irreversible bc;
+  *bc.mutable_topology() = publication.last_irreversible_block;
+
+  _publish( "koinos.block.irreversible", util::converter::as< std::string >( bc ) );
+
+  broadcast::block_accepted ba;
+  *ba.mutable_block()   = publication.block;
+  *ba.mutable_receipt() = publication.receipt;
+  ba.set_live( publication.live );
+  ba.set_head( publication.head );
+
+  _publish( "koinos.block.accept", util::converter::as< std::string >( ba ) );
+
+  broadcast::fork_heads fh;
+  fh.set_allocated_last_irreversible_block( bc.release_topology() );
+
+  for( const auto& fork_head: publication.fork_heads )
+  {
+    auto* head = fh.add_heads();
+    *head      = fork_head;
+  }
+
+  _publish( "koinos.block.forks", util::converter::as< std::string >( fh ) );
+
+  broadcast::event_parcel ep;
+  ep.set_block_id( publication.block.id() );
+  ep.set_height( publication.block.header().height() );
+
+  const bool batch_events = _batch_events && publication.events.size();
+  std::string batch;
+
+  {
+    google::protobuf::io::StringOutputStream batch_stream( &batch );
+    google::protobuf::io::CodedOutputStream coded_batch( &batch_stream );
+
+    for( const auto& [ transaction_id, event ]: publication.events )
+    {
+      *ep.mutable_event() = event;
+
+      if( transaction_id )
+        ep.set_transaction_id( *transaction_id );
+      else
+        ep.clear_transaction_id();
+
+      auto payload = ep.SerializeAsString();
+
+      if( batch_events )
+      {
+        coded_batch.WriteVarint32( uint32_t( payload.size() ) );
+        coded_batch.WriteString( payload );
+      }
+
+      _publish( event_topic_prefix( event.source() ) + event.name(), payload );
+    }
+  }
+
+  if( batch_events )
+    _publish( "koinos.block.events", batch );
+}
+
+const std::string& broadcast_publisher::event_topic_prefix( const std::string& source )
+{
+  if( auto itr = _event_topic_prefixes.find( source ); itr != _event_topic_prefixes.end() )
+  {
+    // Move the source to the front of the list
+    _event_topic_lru.splice( _event_topic_lru.begin(), _event_topic_lru, itr->second.second );
+    return itr->second.first;
+  }
+
+  // If the cache is full, evict the least recently used source
+  if( _event_topic_lru.size() >= max_event_topic_prefixes )
+  {
+    _event_topic_prefixes.erase( _event_topic_lru.back() );
+    _event_topic_lru.pop_back();
+  }
+
+  _event_topic_lru.push_front( source );
+  return _event_topic_prefixes
+    .emplace( source,
+              std::make_pair( "koinos.event." + util::to_base58( source ) + ".", _event_topic_lru.begin() ) )
+    .first->second.first;
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <koinos/chain/chronicler.hpp>
+
+#include <koinos/broadcast/broadcast.pb.h>
+#include <koinos/protocol/protocol.pb.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace koinos::chain {
+
+struct block_publication
+{
+  protocol::block block;
+  protocol::block_receipt receipt;
+  bool live = false;
+  bool head = false;
+  std::vector< block_topology > fork_heads;
+  block_topology last_irreversible_block;
+  std::vector< event_bundle > events;
+};
+
+/**
+ * Publishes broadcasts on its own thread, in the order they were queued.
+ *
+ * A block publication is serialized and published as koinos.block.irreversible, koinos.block.accept,
+ * koinos.block.forks and one koinos.event.<source>.<name> message per event. When batching is enabled,
+ * the events of the block are additionally published together as koinos.block.events. Its payload is the
+ * event_parcel of every event in sequence, each prefixed by its length as a varint, the same framing as
+ * protobuf's delimited message streams.
+ *
+ * At most max_queued publications are waiting at any time, queueing beyond that blocks.
+ */
+class broadcast_publisher final
+{
+public:
+  using publish_function = std::function< void( const std::string&, const std::string& ) >;
+
+  static constexpr std::size_t default_max_queued = 256;
+
+  broadcast_publisher( publish_function publish,
+                       bool batch_events      = false,
+                       std::size_t max_queued = default_max_queued );
+  ~broadcast_publisher();
+
+  void publish_block( block_publication&& publication );
+  void publish( std::string topic, std::string payload );
+
+  // Blocks until everything queued so far has been published
+  void flush();
+
+private:
+  using message = std::pair< std::string, std::string >;
+
+  void enqueue( std::variant< block_publication, message >&& item );
+  void run();
+  void publish_block_messages( const block_publication& publication );
+  const std::string& event_topic_prefix( const std::string& source );
+
+  publish_function _publish;
+  bool _batch_events;
+  std::size_t _max_queued;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque< std::variant< block_publication, message > > _queue;
+  std::size_t _queued = 0;
+  bool _stopping      = false;
+
+  using topic_prefix_list = std::list< std::string >;
+
+  // Only accessed from the publishing thread
+  topic_prefix_list _event_topic_lru;
+  std::unordered_map< std::string, std::pair< std::string, typename topic_prefix_list::iterator > >
+    _event_topic_prefixes;
+
+  std::thread _thread;
+};
+
+} // namespace koinos::chain
@@ -18,12 +18,12 @@ void chronicler::push_event( std::optional< std::string > transaction_id, protoc
   _seq_no++;
 }
 
-void chronicler::push_log( const std::string& message )
+void chronicler::push_log( std::string message )
 {
   if( auto session = _session.lock() )
-    session->push_log( message );
+    session->push_log( std::move( message ) );
   else
-    _logs.push_back( message );
+    _logs.push_back( std::move( message ) );
 }
 
 const std::vector< event_bundle >& chronicler::events()
@@ -36,4 +36,22 @@ const std::vector< std::string >& chronicler::logs()
   return _logs;
 }
 
+std::vector< event_bundle > chronicler::take_events()
+{
+  return std::exchange( _events, {} );
+}
+
+void chronicler::merge( chronicler&& other )
+{
+  for( auto& [ transaction_id, ev ]: other._events )
+    push_event( std::move( transaction_id ), std::move( ev ) );
+
+  for( auto& message: other._logs )
+    push_log( std::move( message ) );
+
+  other._events.clear();
+  other._logs.clear();
+  other._seq_no = 0;
+}
+
 } // namespace koinos::chain
@@ -16,7 +16,7 @@ struct abstract_chronicler_session
   virtual void push_event( const protocol::event_data& ev )   = 0;
   virtual const std::vector< protocol::event_data >& events() = 0;
 
-  virtual void push_log( const std::string& log )  = 0;
+  virtual void push_log( std::string log )         = 0;
   virtual const std::vector< std::string >& logs() = 0;
 };
 
@@ -25,10 +25,19 @@ class chronicler final
 public:
   void set_session( std::shared_ptr< abstract_chronicler_session > s );
   void push_event( std::optional< std::string > transaction_id, protocol::event_data&& ev );
-  void push_log( const std::string& message );
+  void push_log( std::string message );
   const std::vector< event_bundle >& events();
   const std::vector< std::string >& logs();
 
+  // Moves the events out of the chronicler, once they are no longer needed by it
+  std::vector< event_bundle > take_events();
+
+  /**
+   * Pushes the events and logs of another chronicler onto this one, in order. Events are
+   * assigned new sequence numbers as they are pushed.
+   */
+  void merge( chronicler&& other );
+
 private:
   std::weak_ptr< abstract_chronicler_session > _session;
   std::vector< event_bundle > _events;
@@ -0,0 +1,130 @@
+#include <koinos/chain/compute_registry.hpp>
+#include <koinos/chain/exceptions.hpp>
+
+#include <koinos/chain/system_call_ids.pb.h>
+
+#include <algorithm>
+#include <string_view>
+
+namespace koinos::chain {
+
+namespace {
+
+constexpr std::array< std::string_view, std::size_t( compute_cost::num_costs ) > compute_cost_names = {
+  "object_serialization_per_byte",
+  "event_per_impacted",
+  "deserialize_message_per_byte",
+  "deserialize_multihash_base",
+  "deserialize_multihash_per_byte",
+  "sha1_base",
+  "sha1_per_byte",
+  "sha2_256_base",
+  "sha2_256_per_byte",
+  "sha2_512_base",
+  "sha2_512_per_byte",
+  "keccak_256_base",
+  "keccak_256_per_byte",
+  "ripemd_160_base",
+  "ripemd_160_per_byte" };
+
+} // namespace
+
+compute_registry::compute_registry( const compute_bandwidth_registry& registry )
+{
+  for( const auto& entry: registry.entries() )
+    _named[ entry.name() ] = entry.compute();
+
+  auto find = [ & ]( const std::string& name ) -> std::optional< uint64_t >
+  {
+    if( auto itr = _named.find( name ); itr != _named.end() )
+      return itr->second;
+
+    return {};
+  };
+
+  const auto* desc = system_call_id_descriptor();
+  int max_id       = 0;
+
+  for( int i = 0; i < desc->value_count(); i++ )
+    max_id = std::max( max_id, desc->value( i )->number() );
+
+  _thunks.resize( std::size_t( max_id ) + 1 );
+
+  for( int i = 0; i < desc->value_count(); i++ )
+  {
+    const auto* value = desc->value( i );
+    auto& entry       = _thunks[ std::size_t( value->number() ) ];
+
+    // Aliased values resolve to the first name, as FindValueByNumber does
+    if( entry.descriptor )
+      continue;
+
+    entry.descriptor = value;
+    entry.compute    = find( value->name() );
+  }
+
+  for( std::size_t i = 0; i < compute_cost_names.size(); i++ )
+    _costs[ i ] = find( std::string( compute_cost_names[ i ] ) );
+}
+
+uint64_t compute_registry::thunk_compute( uint32_t thunk_id ) const
+{
+  KOINOS_ASSERT( thunk_id < _thunks.size() && _thunks[ thunk_id ].descriptor,
+                 unknown_thunk_exception,
+                 "unrecognized thunk id ${id}",
+                 ( "id", thunk_id ) );
+
+  const auto& entry = _thunks[ thunk_id ];
+
+  KOINOS_ASSERT( entry.compute,
+                 reversion_exception,
+                 "unable to find compute bandwidth for ${t}",
+                 ( "t", entry.descriptor->name() ) );
+
+  return *entry.compute;
+}
+
+uint64_t compute_registry::compute( compute_cost cost ) const
+{
+  const auto& value = _costs[ std::size_t( cost ) ];
+
+  KOINOS_ASSERT( value,
+                 reversion_exception,
+                 "unable to find compute bandwidth for ${t}",
+                 ( "t", std::string( compute_cost_names[ std::size_t( cost ) ] ) ) );
+
+  return *value;
+}
+
+uint64_t compute_registry::compute( const std::string& name ) const
+{
+  auto itr = _named.find( name );
+
+  KOINOS_ASSERT( itr != _named.end(),
+                 reversion_exception,
+                 "unable to find compute bandwidth for ${t}",
+                 ( "t", name ) );
+
+  return itr->second;
+}
+
+std::pair< compute_cost, compute_cost > compute_registry::hash_costs( crypto::multicodec code )
+{
+  switch( code )
+  {
+    case crypto::multicodec::sha1:
+      return { compute_cost::sha1_base, compute_cost::sha1_per_byte };
+    case crypto::multicodec::sha2_256:
+      return { compute_cost::sha2_256_base, compute_cost::sha2_256_per_byte };
+    case crypto::multicodec::sha2_512:
+      return { compute_cost::sha2_512_base, compute_cost::sha2_512_per_byte };
+    case crypto::multicodec::keccak_256:
+      return { compute_cost::keccak_256_base, compute_cost::keccak_256_per_byte };
+    case crypto::multicodec::ripemd_160:
+      return { compute_cost::ripemd_160_base, compute_cost::ripemd_160_per_byte };
+    default:
+      KOINOS_THROW( unknown_hash_code_exception, "unknown hash code" );
+  }
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <koinos/chain/chain.pb.h>
+#include <koinos/crypto/multihash.hpp>
+
+#include <google/protobuf/descriptor.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace koinos::chain {
+
+// Named compute costs that are charged by thunks in addition to their per call cost
+enum class compute_cost : std::size_t
+{
+  object_serialization_per_byte,
+  event_per_impacted,
+  deserialize_message_per_byte,
+  deserialize_multihash_base,
+  deserialize_multihash_per_byte,
+  sha1_base,
+  sha1_per_byte,
+  sha2_256_base,
+  sha2_256_per_byte,
+  sha2_512_base,
+  sha2_512_per_byte,
+  keccak_256_base,
+  keccak_256_per_byte,
+  ripemd_160_base,
+  ripemd_160_per_byte,
+  num_costs
+};
+
+/**
+ * The compute bandwidth registry, compiled for lookup on the thunk path.
+ *
+ * The cost of every thunk is resolved into a table indexed by thunk id and named costs into fixed slots,
+ * so charging compute never looks up a name. A registry is immutable once built.
+ */
+class compute_registry final
+{
+public:
+  compute_registry( const compute_bandwidth_registry& registry );
+
+  // Throws unknown_thunk_exception when the id is not a thunk and reversion_exception when it has no cost
+  uint64_t thunk_compute( uint32_t thunk_id ) const;
+  uint64_t compute( compute_cost cost ) const;
+  uint64_t compute( const std::string& name ) const;
+
+  static std::pair< compute_cost, compute_cost > hash_costs( crypto::multicodec code );
+
+private:
+  struct thunk_entry
+  {
+    const google::protobuf::EnumValueDescriptor* descriptor = nullptr;
+    std::optional< uint64_t > compute;
+  };
+
+  std::vector< thunk_entry > _thunks;
+  std::array< std::optional< uint64_t >, std::size_t( compute_cost::num_costs ) > _costs;
+  std::map< std::string, uint64_t > _named;
+};
+
+} // namespace koinos::chain
@@ -1,20 +1,28 @@
 #include <koinos/block_store/block_store.pb.h>
 #include <koinos/broadcast/broadcast.pb.h>
 
+#include <koinos/chain/block_store_writer.hpp>
+#include <koinos/chain/broadcast_publisher.hpp>
 #include <koinos/chain/constants.hpp>
 #include <koinos/chain/controller.hpp>
+#include <koinos/chain/dispatch_table.hpp>
 #include <koinos/chain/exceptions.hpp>
 #include <koinos/chain/execution_context.hpp>
 #include <koinos/chain/host_api.hpp>
+#include <koinos/chain/module_prewarmer.hpp>
+#include <koinos/chain/read_cache.hpp>
 #include <koinos/chain/rectify.hpp>
+#include <koinos/chain/snapshot_pins.hpp>
 #include <koinos/chain/state.hpp>
 #include <koinos/chain/system_calls.hpp>
+#include <koinos/chain/verification_memo.hpp>
+#include <koinos/chain/verified_transaction_cache.hpp>
+#include <koinos/chain/worker_pool.hpp>
 
 #include <koinos/exception.hpp>
 
 #include <koinos/protocol/protocol.pb.h>
 
-#include <koinos/rpc/block_store/block_store_rpc.pb.h>
 #include <koinos/rpc/chain/chain_rpc.pb.h>
 #include <koinos/rpc/mempool/mempool_rpc.pb.h>
 
@@ -28,13 +36,16 @@
 #include <koinos/vm_manager/vm_backend.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_map>
 
 #include <boost/interprocess/streams/vectorstream.hpp>
 
@@ -47,6 +58,35 @@ using fork_data = std::pair< std::vector< block_topology >, block_topology >;
 
 namespace detail {
 
+block_topology make_topology( const state_db::state_node_ptr& node )
+{
+  block_topology topology;
+  topology.set_id( util::converter::as< std::string >( node->id() ) );
+  topology.set_previous( util::converter::as< std::string >( node->parent_id() ) );
+  topology.set_height( node->revision() );
+  return topology;
+}
+
+bool is_space( const object_space& space, const object_space& other )
+{
+  return space.system() == other.system() && space.zone() == other.zone() && space.id() == other.id();
+}
+
+// Whether the node changed anything system call dispatch is resolved from
+bool modifies_dispatch( const state_db::state_node_ptr& node )
+{
+  for( const auto& entry: node->get_delta_entries() )
+  {
+    const auto& space = entry.object_space();
+
+    if( is_space( space, state::space::system_call_dispatch() ) || is_space( space, state::space::contract_metadata() )
+        || is_space( space, state::space::contract_bytecode() ) )
+      return true;
+  }
+
+  return false;
+}
+
 std::string format_time( int64_t time )
 {
   std::stringstream ss;
@@ -85,6 +125,34 @@ struct apply_block_options
   bool propose_block;
 };
 
+/**
+ * An immutable view of the head block, published atomically whenever the head changes.
+ *
+ * Readers pin snapshots before loading one and hold the pin for as long as they use its state node, so that
+ * the node can not be committed or discarded underneath them. Neither pinning nor reading takes the database
+ * lock, so reads never wait on block application. Head info is served from the snapshot without a pin.
+ */
+struct head_snapshot
+{
+  std::shared_ptr< const protocol::block > block;
+  state_db::state_node_ptr node;
+  rpc::chain::get_head_info_response head_info;
+  std::shared_ptr< dispatch_table > dispatch;
+  mutable read_cache cache;
+};
+
+struct read_batch
+{
+  const controller_impl* controller;
+  snapshot_pins::pin_ptr pin;
+  std::shared_ptr< const head_snapshot > head;
+  std::shared_ptr< execution_context_cache > cache;
+  read_batch* previous;
+};
+
+// The read batch the current thread is executing, if any
+thread_local read_batch* current_read_batch = nullptr;
+
 struct apply_block_result
 {
   std::optional< protocol::block_receipt > receipt;
@@ -96,7 +164,11 @@ class controller_impl final
 public:
   controller_impl( uint64_t read_compute_bandwith_limit,
                    uint32_t syscall_bufsize,
-                   std::optional< uint64_t > pending_transaction_limit );
+                   std::optional< uint64_t > pending_transaction_limit,
+                   uint64_t verification_threads,
+                   bool parallel_transactions,
+                   bool batch_events,
+                   uint64_t module_cache_size );
   ~controller_impl();
 
   void open( const std::filesystem::path& p, const genesis_data& data, fork_resolution_algorithm algo, bool reset );
@@ -116,6 +188,12 @@ public:
   rpc::chain::get_resource_limits_response get_resource_limits( const rpc::chain::get_resource_limits_request& );
   rpc::chain::invoke_system_call_response invoke_system_call( const rpc::chain::invoke_system_call_request& );
 
+  read_cache_stats get_read_cache_stats() const;
+  vm_manager::module_cache_stats get_module_cache_stats() const;
+  block_store_stats get_block_store_stats() const;
+
+  std::unique_ptr< read_batch > begin_read_batch();
+
 private:
   state_db::database _db;
   std::shared_ptr< vm_manager::vm_backend > _vm_backend;
@@ -123,26 +201,92 @@ private:
   uint64_t _read_compute_bandwidth_limit;
   uint32_t _syscall_bufsize;
   std::optional< uint64_t > _pending_transaction_limit;
-  std::shared_mutex _cached_head_block_mutex;
-  std::shared_ptr< const protocol::block > _cached_head_block;
+  std::atomic< std::shared_ptr< const head_snapshot > > _head_snapshot;
+  snapshot_pins _snapshot_pins;
+  std::atomic< uint64_t > _read_cache_hits   = 0;
+  std::atomic< uint64_t > _read_cache_misses = 0;
+  std::unique_ptr< worker_pool > _worker_pool;
+  verified_transaction_cache _verified_transactions;
+  bool _parallel_transactions;
+  bool _batch_events;
+  std::unique_ptr< block_store_writer > _block_store_writer;
+  std::unique_ptr< broadcast_publisher > _publisher;
+
+  // Commits wait for pinned readers only once LIB has moved this many blocks past the root
+  static constexpr uint64_t max_deferred_commits = 20;
+
+  // Contracts are parsed ahead of their first call, and the most called ones again on restart
+  static constexpr std::size_t max_hot_contracts = 64;
+  std::unique_ptr< module_prewarmer > _prewarmer;
+  std::filesystem::path _hot_contracts_path;
+
+  // Dispatch tables by the id of the finalized node they were resolved from, pruned as LIB advances
+  struct dispatch_table_entry
+  {
+    uint64_t revision;
+    std::shared_ptr< dispatch_table > table;
+  };
+
+  std::mutex _dispatch_tables_mutex;
+  std::unordered_map< std::string, dispatch_table_entry > _dispatch_tables;
+
+  // Fork heads and LIB are tracked as nodes are finalized and committed, so they never require reading state
+  std::shared_mutex _fork_data_mutex;
+  std::vector< block_topology > _fork_heads;
+  block_topology _last_irreversible_block;
+  std::string _head_id;
 
   void validate_block( const protocol::block& b );
   void validate_transaction( const protocol::transaction& t );
-
-  fork_data get_fork_data( state_db::shared_lock_ptr db_lock );
+  std::shared_ptr< const verification_memo > prevalidate_block( const protocol::block& b, execution_context& ctx );
+  std::shared_ptr< const verified_transaction > prevalidate_transaction( const protocol::transaction& t,
+                                                                         execution_context& ctx );
+
+  std::shared_ptr< const head_snapshot > get_head_snapshot() const;
+  snapshot_pins::pin_ptr pin_snapshot();
+  std::shared_ptr< dispatch_table > get_dispatch_table( const state_db::state_node_ptr& node );
+  void prune_dispatch_tables( uint64_t root_revision );
+  void commit_irreversible( uint64_t lib, const crypto::multihash& block_id, const state_db::unique_lock_ptr& db_lock );
+  void prepare_read_cache( execution_context& ctx, const head_snapshot& head ) const;
+  void prewarm_contract( const state_db::state_node_ptr& node, const std::string& contract_id );
+  void prewarm_system_contracts( const state_db::state_node_ptr& node );
+  void prewarm_block_contracts( const protocol::block& block, const state_db::state_node_ptr& node );
+  void publish_head_snapshot( std::shared_ptr< const protocol::block > block,
+                              const state_db::unique_lock_ptr& db_lock );
+  void refresh_head_snapshot( const protocol::block& applied,
+                              const state_db::state_node_ptr& previous_root,
+                              const state_db::unique_lock_ptr& db_lock );
+
+  fork_data get_fork_data();
+  void reset_fork_data( const state_db::unique_lock_ptr& db_lock );
+  void update_fork_data( const crypto::multihash& block_id, const state_db::unique_lock_ptr& db_lock );
 };
 
 controller_impl::controller_impl( uint64_t read_compute_bandwidth_limit,
                                   uint32_t syscall_bufsize,
-                                  std::optional< uint64_t > pending_transaction_limit ):
+                                  std::optional< uint64_t > pending_transaction_limit,
+                                  uint64_t verification_threads,
+                                  bool parallel_transactions,
+                                  bool batch_events,
+                                  uint64_t module_cache_size ):
     _read_compute_bandwidth_limit( read_compute_bandwidth_limit ),
     _syscall_bufsize( syscall_bufsize ),
-    _pending_transaction_limit( pending_transaction_limit )
+    _pending_transaction_limit( pending_transaction_limit ),
+    _parallel_transactions( parallel_transactions ),
+    _batch_events( batch_events )
 {
   _vm_backend = vm_manager::get_vm_backend(); // Default is fizzy
   KOINOS_ASSERT( _vm_backend, unknown_backend_exception, "could not get vm backend" );
 
-  _cached_head_block = std::make_shared< const protocol::block >( protocol::block() );
+  if( module_cache_size )
+    _vm_backend->set_module_cache_size( module_cache_size );
+
+  _prewarmer = std::make_unique< module_prewarmer >( _vm_backend );
+
+  if( verification_threads )
+    _worker_pool = std::make_unique< worker_pool >( verification_threads );
+  else if( _parallel_transactions )
+    LOG( warning ) << "Parallel transactions require verification threads, applying transactions serially";
 
   _vm_backend->initialize();
   LOG( info ) << "Initialized " << _vm_backend->backend_name() << " VM backend";
@@ -211,21 +355,78 @@ void controller_impl::open( const std::filesystem::path& p,
   if( reset )
   {
     LOG( info ) << "Resetting database...";
-    _db.reset( _db.get_unique_lock() );
+    auto db_lock   = _db.get_unique_lock();
+    auto exclusion = _snapshot_pins.exclude( true );
+    _db.reset( db_lock );
+  }
+
+  {
+    auto db_lock = _db.get_unique_lock();
+    reset_fork_data( db_lock );
+    publish_head_snapshot( std::make_shared< const protocol::block >(), db_lock );
   }
 
   auto head = _db.get_head( _db.get_shared_lock() );
   LOG( info ) << "Opened database at block - Height: " << head->revision() << ", ID: " << head->id();
+
+  _hot_contracts_path = p / "hot_contracts";
+
+  {
+    auto db_lock = _db.get_shared_lock();
+    head         = _db.get_head( db_lock );
+
+    prewarm_system_contracts( head );
+
+    for( const auto& contract_id: module_prewarmer::read_hot_contracts( _hot_contracts_path ) )
+      prewarm_contract( head, contract_id );
+  }
 }
 
 void controller_impl::close()
 {
-  _db.close( _db.get_unique_lock() );
+  _head_snapshot.store( nullptr );
+
+  // Stopping stores every applied block, unless the block store keeps failing
+  if( _block_store_writer )
+    _block_store_writer->stop();
+
+  if( _publisher )
+    _publisher->flush();
+
+  if( !_hot_contracts_path.empty() )
+  {
+    _prewarmer->write_hot_contracts( _hot_contracts_path, max_hot_contracts );
+    _hot_contracts_path.clear();
+  }
+
+  auto db_lock   = _db.get_unique_lock();
+  auto exclusion = _snapshot_pins.exclude( true );
+  _db.close( db_lock );
 }
 
 void controller_impl::set_client( std::shared_ptr< mq::client > c )
 {
   _client = c;
+
+  if( _client )
+  {
+    _block_store_writer = std::make_unique< block_store_writer >(
+      [ client = _client ]( const std::string& req )
+      {
+        return client->rpc( util::service::block_store, req, 1'500ms, mq::retry_policy::none );
+      } );
+    _publisher = std::make_unique< broadcast_publisher >(
+      [ client = _client ]( const std::string& topic, const std::string& payload )
+      {
+        client->broadcast( topic, payload );
+      },
+      _batch_events );
+  }
+  else
+  {
+    _block_store_writer.reset();
+    _publisher.reset();
+  }
 }
 
 void controller_impl::validate_block( const protocol::block& b )
@@ -295,6 +496,52 @@ void controller_impl::validate_transaction( const protocol::transaction& t )
                  ( "field", "signature_data" )( "transaction_id", util::to_hex( t.id() ) ) );
 }
 
+std::shared_ptr< const verification_memo > controller_impl::prevalidate_block( const protocol::block& b,
+                                                                             execution_context& ctx )
+{
+  try
+  {
+    if( _worker_pool )
+      return chain::prevalidate_block( *_worker_pool, b, ctx.block_hash_code(), &_verified_transactions );
+
+    // Transactions seen through submit_transaction have already been verified
+    return chain::recall_block( b, ctx.block_hash_code(), _verified_transactions );
+  }
+  catch( const std::exception& e )
+  {
+    // The thunks will do the work themselves and report any error in context
+    LOG( debug ) << "Unable to pre-validate block: " << e.what();
+  }
+
+  return {};
+}
+
+std::shared_ptr< const verified_transaction >
+controller_impl::prevalidate_transaction( const protocol::transaction& t, execution_context& ctx )
+{
+  try
+  {
+    auto code  = ctx.block_hash_code();
+    auto facts = _verified_transactions.find( t, code );
+
+    if( !facts )
+      facts = verify_transaction( t, code );
+
+    auto memo = std::make_shared< verification_memo >();
+    memo->add_transaction( t, facts );
+    ctx.set_verification_memo( std::move( memo ) );
+
+    return facts;
+  }
+  catch( const std::exception& e )
+  {
+    // The thunks will do the work themselves and report any error in context
+    LOG( debug ) << "Unable to pre-validate transaction: " << e.what();
+  }
+
+  return {};
+}
+
 apply_block_result controller_impl::apply_block( const protocol::block& block, const apply_block_options& opts )
 {
   validate_block( block );
@@ -354,7 +601,8 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
   // than the parent block timestamp.
   if( block_node && !parent_id.is_zero() )
   {
-    execution_context parent_ctx( _vm_backend, intent::read_only );
+    auto pooled_parent_ctx = execution_context_pool::acquire( _vm_backend, intent::read_only );
+    auto& parent_ctx       = *pooled_parent_ctx;
 
     parent_ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
 
@@ -365,7 +613,10 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
     time_lower_bound = head_info.head_block_time();
   }
 
-  execution_context ctx( _vm_backend, opts.propose_block ? intent::block_proposal : intent::block_application );
+  auto pooled_ctx =
+    execution_context_pool::acquire( _vm_backend,
+                                     opts.propose_block ? intent::block_proposal : intent::block_application );
+  auto& ctx       = *pooled_ctx;
 
   try
   {
@@ -398,9 +649,17 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
 
     ctx.set_state_node( block_node );
     ctx.reset_cache();
+    ctx.set_dispatch_table( get_dispatch_table( parent_node ) );
+    ctx.set_verification_memo( prevalidate_block( block, ctx ) );
+
+    if( _worker_pool && _parallel_transactions )
+      ctx.set_worker_pool( *_worker_pool, db_lock );
 
     system_call::apply_block( ctx, block );
 
+    // The workers hold on to the database lock, which has to be released before finalizing
+    ctx.clear_worker_pool();
+
     res.failed_transaction_indices = ctx.get_failed_transaction_indices();
 
     if( opts.propose_block && res.failed_transaction_indices.size() )
@@ -420,30 +679,8 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
 
     maybe_rectify_state( ctx, block, *res.receipt );
 
-    if( _client )
-    {
-      rpc::block_store::block_store_request req;
-      req.mutable_add_block()->mutable_block_to_add()->CopyFrom( block );
-      req.mutable_add_block()->mutable_receipt_to_add()->CopyFrom(
-        std::get< protocol::block_receipt >( ctx.receipt() ) );
-
-      auto future = _client->rpc( util::service::block_store,
-                                  util::converter::as< std::string >( req ),
-                                  1'500ms,
-                                  mq::retry_policy::none );
-
-      rpc::block_store::block_store_response resp;
-      resp.ParseFromString( future.get() );
-
-      KOINOS_ASSERT( !resp.has_error(),
-                     rpc_failure_exception,
-                     "received error from block store: ${e}",
-                     ( "e", resp.error() ) );
-      KOINOS_ASSERT( resp.has_add_block(),
-                     rpc_failure_exception,
-                     "unexpected response when submitting block: ${r}",
-                     ( "r", resp ) );
-    }
+    if( _block_store_writer )
+      _block_store_writer->add_block( block, std::get< protocol::block_receipt >( ctx.receipt() ) );
 
     if( !opts.index_to && live )
     {
@@ -474,8 +711,8 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
 
     try
     {
-      // We need to finalize our node, checking if it is the new head block, update the cached head block,
-      // and advancing LIB as an atomic action or else we risk _db.get_head(), _cached_head_block, and
+      // We need to finalize our node, checking if it is the new head block, publish the head snapshot,
+      // and advancing LIB as an atomic action or else we risk _db.get_head(), the head snapshot, and
       // LIB desyncing from each other
       db_lock.reset();
       block_node.reset();
@@ -488,18 +725,13 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
       res.receipt->set_state_merkle_root(
         util::converter::as< std::string >( _db.get_node( block_id, unique_db_lock )->merkle_root() ) );
 
-      if( block_id == _db.get_head( unique_db_lock )->id() )
-      {
-        std::unique_lock< std::shared_mutex > head_lock( _cached_head_block_mutex );
-        new_head           = true;
-        _cached_head_block = std::make_shared< protocol::block >( block );
-      }
+      new_head = block_id == _db.get_head( unique_db_lock )->id();
+      auto previous_root = _db.get_root( unique_db_lock );
 
-      if( lib > _db.get_root( unique_db_lock )->revision() )
-      {
-        auto lib_id = _db.get_node_at_revision( lib, block_id, unique_db_lock )->id();
-        _db.commit_node( lib_id, unique_db_lock );
-      }
+      commit_irreversible( lib, block_id, unique_db_lock );
+
+      update_fork_data( block_id, unique_db_lock );
+      refresh_head_snapshot( block, previous_root, unique_db_lock );
 
       unique_db_lock.reset();
       db_lock    = _db.get_shared_lock();
@@ -517,47 +749,24 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
 
     // It is NOT safe to use block_node after this point without checking it against null
 
-    if( _client )
-    {
-      const auto [ fork_heads, last_irreversible_block ] = get_fork_data( db_lock );
-
-      broadcast::block_irreversible bc;
-      bc.mutable_topology()->CopyFrom( last_irreversible_block );
-
-      _client->broadcast( "koinos.block.irreversible", util::converter::as< std::string >( bc ) );
-
-      broadcast::block_accepted ba;
-      *ba.mutable_block()   = block;
-      *ba.mutable_receipt() = std::get< protocol::block_receipt >( ctx.receipt() );
-      ba.set_live( live );
-      ba.set_head( new_head );
+    if( block_node )
+      prewarm_block_contracts( block, block_node );
 
-      _client->broadcast( "koinos.block.accept", util::converter::as< std::string >( ba ) );
-
-      broadcast::fork_heads fh;
-      fh.set_allocated_last_irreversible_block( bc.release_topology() );
-
-      for( const auto& fork_head: fork_heads )
-      {
-        auto* head = fh.add_heads();
-        *head      = fork_head;
-      }
-
-      _client->broadcast( "koinos.block.forks", util::converter::as< std::string >( fh ) );
-
-      for( const auto& [ transaction_id, event ]: ctx.chronicler().events() )
-      {
-        broadcast::event_parcel ep;
-        ep.set_block_id( block.id() );
-        ep.set_height( block.header().height() );
-        *ep.mutable_event() = event;
-
-        if( transaction_id )
-          ep.set_transaction_id( *transaction_id );
-
-        _client->broadcast( "koinos.event." + util::to_base58( event.source() ) + "." + event.name(),
-                            ep.SerializeAsString() );
-      }
+    if( _publisher )
+    {
+      auto [ fork_heads, last_irreversible_block ] = get_fork_data();
+
+      // Serialization and publishing happen on the publisher thread
+      block_publication publication;
+      publication.block                   = block;
+      publication.receipt                 = std::move( std::get< protocol::block_receipt >( ctx.receipt() ) );
+      publication.live                    = live;
+      publication.head                    = new_head;
+      publication.fork_heads              = std::move( fork_heads );
+      publication.last_irreversible_block = std::move( last_irreversible_block );
+      publication.events                  = ctx.chronicler().take_events();
+
+      _publisher->publish_block( std::move( publication ) );
     }
   }
   catch( const block_state_error_exception& e )
@@ -585,20 +794,20 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
 
     if( opts.propose_block && res.failed_transaction_indices.size() )
     {
-      if( _client )
+      if( _publisher )
       {
         broadcast::transaction_failed trx_failed;
 
         for( auto i: res.failed_transaction_indices )
         {
           trx_failed.set_id( block.transactions( i ).id() );
-          _client->broadcast( "koinos.transaction.fail", util::converter::as< std::string >( trx_failed ) );
+          _publisher->publish( "koinos.transaction.fail", util::converter::as< std::string >( trx_failed ) );
         }
       }
 
       return res;
     }
-    else if( _client )
+    else if( _publisher )
     {
       const auto& exception_data = e.get_json();
 
@@ -606,7 +815,7 @@ apply_block_result controller_impl::apply_block( const protocol::block& block, c
       {
         broadcast::transaction_failed ptf;
         ptf.set_id( util::from_hex< std::string >( exception_data[ "transaction_id" ] ) );
-        _client->broadcast( "koinos.transaction.fail", util::converter::as< std::string >( ptf ) );
+        _publisher->publish( "koinos.transaction.fail", util::converter::as< std::string >( ptf ) );
       }
     }
 
@@ -650,6 +859,9 @@ void controller_impl::apply_block_delta( const protocol::block& block,
   if( block_node )
   {
     block_node.reset();
+
+    // The node may be the head that readers are pinned to
+    auto exclusion = _snapshot_pins.exclude( true );
     _db.discard_node( block_id, db_lock );
   }
 
@@ -666,7 +878,8 @@ void controller_impl::apply_block_delta( const protocol::block& block,
 
   block_node = _db.create_writable_node( parent_id, block_id, block.header(), db_lock );
 
-  execution_context ctx( _vm_backend, intent::block_application );
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend, intent::block_application );
+  auto& ctx       = *pooled_ctx;
 
   try
   {
@@ -698,8 +911,8 @@ void controller_impl::apply_block_delta( const protocol::block& block,
 
     try
     {
-      // We need to finalize our node, checking if it is the new head block, update the cached head block,
-      // and advancing LIB as an atomic action or else we risk _db.get_head(), _cached_head_block, and
+      // We need to finalize our node, checking if it is the new head block, publish the head snapshot,
+      // and advancing LIB as an atomic action or else we risk _db.get_head(), the head snapshot, and
       // LIB desyncing from each other
       db_lock.reset();
       block_node.reset();
@@ -709,17 +922,12 @@ void controller_impl::apply_block_delta( const protocol::block& block,
       auto unique_db_lock = _db.get_unique_lock();
       _db.finalize_node( block_id, unique_db_lock );
 
-      if( block_id == _db.get_head( unique_db_lock )->id() )
-      {
-        std::unique_lock< std::shared_mutex > head_lock( _cached_head_block_mutex );
-        _cached_head_block = std::make_shared< protocol::block >( block );
-      }
+      auto previous_root = _db.get_root( unique_db_lock );
 
-      if( lib > _db.get_root( unique_db_lock )->revision() )
-      {
-        auto lib_id = _db.get_node_at_revision( lib, block_id, unique_db_lock )->id();
-        _db.commit_node( lib_id, unique_db_lock );
-      }
+      commit_irreversible( lib, block_id, unique_db_lock );
+
+      update_fork_data( block_id, unique_db_lock );
+      refresh_head_snapshot( block, previous_root, unique_db_lock );
 
       unique_db_lock.reset();
       db_lock    = _db.get_shared_lock();
@@ -797,27 +1005,20 @@ controller_impl::submit_transaction( const rpc::chain::submit_transaction_reques
 
   LOG( debug ) << "Pushing transaction - ID: " << transaction_id;
 
-  auto db_lock = _db.get_shared_lock();
-  state_node_ptr head;
-  execution_context ctx( _vm_backend, intent::transaction_application );
-  std::shared_ptr< const protocol::block > head_block_ptr;
-
-  {
-    std::shared_lock< std::shared_mutex > head_lock( _cached_head_block_mutex );
-    head_block_ptr = _cached_head_block;
-    KOINOS_ASSERT( head_block_ptr, internal_error_exception, "error retrieving head block" );
-
-    head = _db.get_head( db_lock );
-  }
+  auto pin        = pin_snapshot();
+  auto head       = get_head_snapshot();
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend, intent::transaction_application );
+  auto& ctx       = *pooled_ctx;
 
-  ctx.set_block( *head_block_ptr );
-  ctx.set_state_node( head->create_anonymous_node() );
+  ctx.set_block( *head->block );
+  ctx.set_state_node( head->node->create_anonymous_node() );
 
   ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
 
   try
   {
     ctx.reset_cache();
+    ctx.set_dispatch_table( head->dispatch );
 
     payer        = transaction.header().payer();
     payee        = transaction.header().payee();
@@ -926,17 +1127,23 @@ controller_impl::submit_transaction( const rpc::chain::submit_transaction_reques
       }
     }
 
+    auto facts = prevalidate_transaction( transaction, ctx );
+
     ctx.resource_meter().set_resource_limit_data( system_call::get_resource_limits( ctx ) );
     system_call::apply_transaction( ctx, transaction );
 
     LOG( debug ) << "Transaction applied - ID: " << transaction_id;
 
+    // The facts are kept so that the block path can skip verifying the transaction again
+    if( facts )
+      _verified_transactions.add( transaction, std::move( facts ) );
+
     KOINOS_ASSERT( std::holds_alternative< protocol::transaction_receipt >( ctx.receipt() ),
                    unexpected_receipt_exception,
                    "expected transaction receipt" );
     *resp.mutable_receipt() = std::get< protocol::transaction_receipt >( ctx.receipt() );
 
-    if( request.broadcast() && _client )
+    if( request.broadcast() && _publisher )
     {
       broadcast::transaction_accepted ta;
       *ta.mutable_transaction() = transaction;
@@ -948,7 +1155,7 @@ controller_impl::submit_transaction( const rpc::chain::submit_transaction_reques
       ta.set_system_compute_bandwidth_used( ctx.resource_meter().compute_bandwidth_used()
                                             - ta.receipt().compute_bandwidth_used() );
 
-      _client->broadcast( "koinos.transaction.accept", util::converter::as< std::string >( ta ) );
+      _publisher->publish( "koinos.transaction.accept", util::converter::as< std::string >( ta ) );
     }
   }
   catch( koinos::exception& e )
@@ -971,114 +1178,335 @@ controller_impl::submit_transaction( const rpc::chain::submit_transaction_reques
 
 rpc::chain::get_head_info_response controller_impl::get_head_info( const rpc::chain::get_head_info_request& )
 {
-  execution_context ctx( _vm_backend );
-  ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
+  return get_head_snapshot()->head_info;
+}
 
-  auto db_lock = _db.get_shared_lock();
-  state_node_ptr head;
-  std::shared_ptr< const protocol::block > head_block_ptr;
+rpc::chain::get_chain_id_response controller_impl::get_chain_id( const rpc::chain::get_chain_id_request& )
+{
+  auto pin  = pin_snapshot();
+  auto head = get_head_snapshot();
 
+  rpc::chain::get_chain_id_response resp;
+
+  if( auto chain_id = head->cache.chain_id(); chain_id )
   {
-    std::shared_lock< std::shared_mutex > head_lock( _cached_head_block_mutex );
-    head_block_ptr = _cached_head_block;
+    _read_cache_hits++;
+    resp.set_chain_id( *chain_id );
+    return resp;
+  }
+
+  _read_cache_misses++;
+
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend );
+  auto& ctx       = *pooled_ctx;
+  ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
+
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  prepare_read_cache( ctx, *head );
+
+  resp.set_chain_id( system_call::get_chain_id( ctx ) );
+  head->cache.set_chain_id( resp.chain_id() );
+
+  return resp;
+}
+
+std::shared_ptr< const head_snapshot > controller_impl::get_head_snapshot() const
+{
+  if( current_read_batch != nullptr && current_read_batch->controller == this )
+    return current_read_batch->head;
+
+  auto snapshot = _head_snapshot.load();
+  KOINOS_ASSERT( snapshot, internal_error_exception, "error retrieving head snapshot" );
+  return snapshot;
+}
+
+void controller_impl::prepare_read_cache( execution_context& ctx, const head_snapshot& head ) const
+{
+  // Reads within a batch execute against the same head and can share what has been cached from it
+  if( current_read_batch != nullptr && current_read_batch->controller == this )
+    ctx.set_cache( current_read_batch->cache );
+  else
+    ctx.reset_cache();
+
+  ctx.set_dispatch_table( head.dispatch );
+}
+
+snapshot_pins::pin_ptr controller_impl::pin_snapshot()
+{
+  // A read batch holds one pin for all of its reads
+  if( current_read_batch != nullptr && current_read_batch->controller == this )
+    return current_read_batch->pin;
+
+  return _snapshot_pins.pin();
+}
 
-    KOINOS_ASSERT( head_block_ptr, internal_error_exception, "error retrieving head block" );
+std::unique_ptr< read_batch > controller_impl::begin_read_batch()
+{
+  auto batch        = std::make_unique< read_batch >();
+  batch->pin        = pin_snapshot();
+  batch->head       = get_head_snapshot();
+  batch->controller = this;
+  batch->cache      = std::make_shared< execution_context_cache >();
+  return batch;
+}
+
+std::shared_ptr< dispatch_table > controller_impl::get_dispatch_table( const state_db::state_node_ptr& node )
+{
+  auto id     = util::converter::as< std::string >( node->id() );
+  auto parent = node->parent();
+
+  // Scanning the delta does not need the lock, so it is done before taking it
+  std::optional< std::string > parent_id;
+  if( parent && !modifies_dispatch( node ) )
+    parent_id = util::converter::as< std::string >( parent->id() );
 
-    head = _db.get_head( db_lock );
+  std::lock_guard< std::mutex > lock( _dispatch_tables_mutex );
+
+  if( auto itr = _dispatch_tables.find( id ); itr != _dispatch_tables.end() )
+    return itr->second.table;
+
+  std::shared_ptr< dispatch_table > table;
+
+  // A node that did not modify dispatch resolves system calls exactly as its parent does
+  if( parent_id )
+  {
+    if( auto itr = _dispatch_tables.find( *parent_id ); itr != _dispatch_tables.end() )
+      table = itr->second.table;
   }
 
-  ctx.set_state_node( head->create_anonymous_node() );
+  if( !table )
+    table = std::make_shared< dispatch_table >();
 
-  KOINOS_ASSERT( head_block_ptr, internal_error_exception, "error retrieving head block" );
+  _dispatch_tables.emplace( std::move( id ), dispatch_table_entry{ .revision = node->revision(), .table = table } );
 
-  ctx.set_block( *head_block_ptr );
-  ctx.reset_cache();
+  return table;
+}
 
-  auto head_info      = system_call::get_head_info( ctx );
-  block_topology topo = head_info.head_topology();
+void controller_impl::commit_irreversible( uint64_t lib,
+                                          const crypto::multihash& block_id,
+                                          const state_db::unique_lock_ptr& db_lock )
+{
+  auto root_revision = _db.get_root( db_lock )->revision();
 
-  rpc::chain::get_head_info_response resp;
-  *resp.mutable_head_topology() = topo;
-  resp.set_last_irreversible_block( head_info.last_irreversible_block() );
-  resp.set_head_state_merkle_root( util::converter::as< std::string >( head->merkle_root() ) );
-  resp.set_head_block_time( head_info.head_block_time() );
+  if( lib <= root_revision )
+    return;
 
-  return resp;
+  // While readers are pinned the commit is left to a later block, unless LIB has moved too far past the root
+  auto exclusion = _snapshot_pins.exclude( lib - root_revision > max_deferred_commits );
+  if( !exclusion.owns_lock() )
+    return;
+
+  auto lib_id = _db.get_node_at_revision( lib, block_id, db_lock )->id();
+  _db.commit_node( lib_id, db_lock );
+  prune_dispatch_tables( lib );
 }
 
-rpc::chain::get_chain_id_response controller_impl::get_chain_id( const rpc::chain::get_chain_id_request& )
+void controller_impl::prune_dispatch_tables( uint64_t root_revision )
 {
-  execution_context ctx( _vm_backend );
-  ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
+  std::lock_guard< std::mutex > lock( _dispatch_tables_mutex );
 
-  ctx.set_state_node( _db.get_head( _db.get_shared_lock() )->create_anonymous_node() );
-  ctx.reset_cache();
+  // Nodes below the root have been committed or discarded and will never be resolved again
+  std::erase_if( _dispatch_tables, [ & ]( const auto& entry ) { return entry.second.revision < root_revision; } );
+}
 
-  rpc::chain::get_chain_id_response resp;
-  resp.set_chain_id( system_call::get_chain_id( ctx ) );
+void controller_impl::prewarm_contract( const state_db::state_node_ptr& node, const std::string& contract_id )
+{
+  auto meta     = node->get_object( state::space::contract_metadata(), contract_id );
+  auto bytecode = node->get_object( state::space::contract_bytecode(), contract_id );
 
-  return resp;
+  if( !meta || !bytecode )
+    return;
+
+  // Modules are cached under the hash of their bytecode recorded in the contract metadata
+  auto hash = util::converter::to< contract_metadata_object >( *meta ).hash();
+  if( hash.size() )
+    _prewarmer->prewarm( std::move( hash ), *bytecode );
 }
 
-fork_data controller_impl::get_fork_data( state_db::shared_lock_ptr db_lock )
+void controller_impl::prewarm_system_contracts( const state_db::state_node_ptr& node )
 {
-  fork_data fdata;
-  execution_context ctx( _vm_backend );
+  // System call overrides are called by nearly every transaction
+  std::string key;
 
-  ctx.push_frame( koinos::chain::stack_frame{ .call_privilege = privilege::kernel_mode } );
+  while( true )
+  {
+    auto [ obj, next_key ] = node->get_next_object( state::space::system_call_dispatch(), key );
+    if( !obj )
+      break;
+
+    auto target = util::converter::to< protocol::system_call_target >( *obj );
+    if( target.has_system_call_bundle() )
+      prewarm_contract( node, target.system_call_bundle().contract_id() );
+
+    key = next_key;
+  }
+}
+
+void controller_impl::prewarm_block_contracts( const protocol::block& block, const state_db::state_node_ptr& node )
+{
+  for( const auto& trx: block.transactions() )
+  {
+    for( const auto& op: trx.operations() )
+    {
+      if( op.has_upload_contract() )
+        prewarm_contract( node, op.upload_contract().contract_id() );
+      else if( op.has_set_system_call() && op.set_system_call().target().has_system_call_bundle() )
+        prewarm_contract( node, op.set_system_call().target().system_call_bundle().contract_id() );
+      else if( op.has_call_contract() )
+        _prewarmer->record_call( op.call_contract().contract_id() );
+    }
+  }
+}
 
-  std::vector< state_db::state_node_ptr > fork_heads;
+void controller_impl::publish_head_snapshot( std::shared_ptr< const protocol::block > block,
+                                             const state_db::unique_lock_ptr& db_lock )
+{
+  auto snapshot      = std::make_shared< head_snapshot >();
+  snapshot->block    = std::move( block );
+  snapshot->node     = _db.get_head( db_lock );
+  snapshot->dispatch = get_dispatch_table( snapshot->node );
 
-  ctx.set_state_node( _db.get_root( db_lock )->create_anonymous_node() );
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend );
+  auto& ctx       = *pooled_ctx;
+  ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
+  ctx.set_state_node( snapshot->node->create_anonymous_node() );
+  ctx.set_block( *snapshot->block );
   ctx.reset_cache();
-  fork_heads = _db.get_fork_heads( db_lock );
+  ctx.set_dispatch_table( snapshot->dispatch );
 
   auto head_info = system_call::get_head_info( ctx );
-  fdata.second   = head_info.head_topology();
 
-  for( auto& fork: fork_heads )
+  *snapshot->head_info.mutable_head_topology() = head_info.head_topology();
+  snapshot->head_info.set_last_irreversible_block( head_info.last_irreversible_block() );
+  snapshot->head_info.set_head_state_merkle_root( util::converter::as< std::string >( snapshot->node->merkle_root() ) );
+  snapshot->head_info.set_head_block_time( head_info.head_block_time() );
+
+  _head_snapshot.store( std::move( snapshot ) );
+}
+
+void controller_impl::refresh_head_snapshot( const protocol::block& applied,
+                                             const state_db::state_node_ptr& previous_root,
+                                             const state_db::unique_lock_ptr& db_lock )
+{
+  // Committing can move the head off of the applied block and advances LIB, both of which readers must see
+  auto head      = _db.get_head( db_lock );
+  auto current   = _head_snapshot.load();
+  bool same_head = current && current->node->id() == head->id();
+
+  if( same_head && _db.get_root( db_lock )->id() == previous_root->id() )
+    return;
+
+  std::shared_ptr< const protocol::block > head_block;
+
+  if( head->id() == util::converter::to< crypto::multihash >( applied.id() ) )
+    head_block = std::make_shared< const protocol::block >( applied );
+  else if( same_head )
+    head_block = current->block;
+  else if( auto obj = head->get_object( state::space::metadata(), state::key::head_block ); obj != nullptr )
+    head_block = std::make_shared< const protocol::block >( util::converter::to< protocol::block >( *obj ) );
+  else
+    head_block = std::make_shared< const protocol::block >();
+
+  publish_head_snapshot( std::move( head_block ), db_lock );
+}
+
+fork_data controller_impl::get_fork_data()
+{
+  fork_data fdata;
+  std::string head_id;
+
   {
-    ctx.set_state_node( fork->create_anonymous_node() );
-    ctx.reset_cache();
-    auto head_info = system_call::get_head_info( ctx );
-    fdata.first.emplace_back( std::move( head_info.head_topology() ) );
+    std::shared_lock< std::shared_mutex > lock( _fork_data_mutex );
+    fdata.first  = _fork_heads;
+    fdata.second = _last_irreversible_block;
+    head_id      = _head_id;
   }
 
-  // Sort all fork heads by height
+  // Sort all fork heads by height, if there is a tie for highest block, ensure the head block is first
   std::sort( fdata.first.begin(),
              fdata.first.end(),
-             []( const block_topology& a, const block_topology& b )
+             [ & ]( const block_topology& a, const block_topology& b )
              {
-               return a.height() > b.height();
+               if( a.height() != b.height() )
+                 return a.height() > b.height();
+
+               return a.id() == head_id && b.id() != head_id;
              } );
 
-  // If there is a tie for highest block, ensure the head block is first
-  auto fork_itr = fdata.first.begin();
-  while( fork_itr != fdata.first.begin() && fork_itr->id() != head_info.head_topology().id() )
-  {
-    ++fork_itr;
-  }
+  return fdata;
+}
+
+void controller_impl::reset_fork_data( const state_db::unique_lock_ptr& db_lock )
+{
+  std::unique_lock< std::shared_mutex > lock( _fork_data_mutex );
+
+  _fork_heads.clear();
+
+  for( const auto& fork_head: _db.get_fork_heads( db_lock ) )
+    _fork_heads.emplace_back( make_topology( fork_head ) );
 
-  if( fork_itr != fdata.first.begin() )
+  _last_irreversible_block = make_topology( _db.get_root( db_lock ) );
+  _head_id                 = util::converter::as< std::string >( _db.get_head( db_lock )->id() );
+}
+
+void controller_impl::update_fork_data( const crypto::multihash& block_id, const state_db::unique_lock_ptr& db_lock )
+{
+  auto node     = _db.get_node( block_id, db_lock );
+  auto root     = _db.get_root( db_lock );
+  auto previous = util::converter::as< std::string >( node->parent_id() );
+
+  std::unique_lock< std::shared_mutex > lock( _fork_data_mutex );
+
+  // A newly finalized block replaces its parent as a fork head
+  std::erase_if( _fork_heads,
+                 [ & ]( const block_topology& head )
+                 {
+                   return head.id() == previous;
+                 } );
+  _fork_heads.emplace_back( make_topology( node ) );
+
+  if( _last_irreversible_block.id() != util::converter::as< std::string >( root->id() ) )
   {
-    std::iter_swap( fork_itr, fdata.first.begin() );
+    _last_irreversible_block = make_topology( root );
+
+    // Committing a new LIB discards every fork that does not build on it
+    std::erase_if( _fork_heads,
+                   [ & ]( const block_topology& head )
+                   {
+                     return !_db.get_node( util::converter::to< crypto::multihash >( head.id() ), db_lock );
+                   } );
   }
 
-  return fdata;
+  _head_id = util::converter::as< std::string >( _db.get_head( db_lock )->id() );
 }
 
 rpc::chain::get_resource_limits_response
 controller_impl::get_resource_limits( const rpc::chain::get_resource_limits_request& )
 {
-  execution_context ctx( _vm_backend );
+  auto pin  = pin_snapshot();
+  auto head = get_head_snapshot();
+
+  rpc::chain::get_resource_limits_response resp;
+
+  if( auto limits = head->cache.resource_limits(); limits )
+  {
+    _read_cache_hits++;
+    *resp.mutable_resource_limit_data() = std::move( *limits );
+    return resp;
+  }
+
+  _read_cache_misses++;
+
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend );
+  auto& ctx       = *pooled_ctx;
   ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
 
-  ctx.set_state_node( _db.get_head( _db.get_shared_lock() )->create_anonymous_node() );
-  ctx.reset_cache();
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  prepare_read_cache( ctx, *head );
 
   auto value = system_call::get_resource_limits( ctx );
+  head->cache.set_resource_limits( value );
 
-  rpc::chain::get_resource_limits_response resp;
   *resp.mutable_resource_limit_data() = value;
 
   return resp;
@@ -1091,15 +1519,30 @@ rpc::chain::get_account_rc_response controller_impl::get_account_rc( const rpc::
                  "missing expected field: ${f}",
                  ( "f", "payer" ) );
 
-  execution_context ctx( _vm_backend );
+  auto pin  = pin_snapshot();
+  auto head = get_head_snapshot();
+
+  rpc::chain::get_account_rc_response resp;
+
+  if( auto rc = head->cache.account_rc( request.account() ); rc )
+  {
+    _read_cache_hits++;
+    resp.set_rc( *rc );
+    return resp;
+  }
+
+  _read_cache_misses++;
+
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend );
+  auto& ctx       = *pooled_ctx;
   ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
 
-  ctx.set_state_node( _db.get_head( _db.get_shared_lock() )->create_anonymous_node() );
-  ctx.reset_cache();
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  prepare_read_cache( ctx, *head );
 
   auto value = system_call::get_account_rc( ctx, request.account() );
+  head->cache.set_account_rc( request.account(), value );
 
-  rpc::chain::get_account_rc_response resp;
   resp.set_rc( value );
 
   return resp;
@@ -1109,7 +1552,7 @@ rpc::chain::get_fork_heads_response controller_impl::get_fork_heads( const rpc::
 {
   rpc::chain::get_fork_heads_response resp;
 
-  const auto [ fork_heads, last_irreversible_block ] = get_fork_data( _db.get_shared_lock() );
+  const auto [ fork_heads, last_irreversible_block ] = get_fork_data();
   auto topo                                          = resp.mutable_last_irreversible_block();
   *topo                                              = std::move( last_irreversible_block );
 
@@ -1129,25 +1572,18 @@ rpc::chain::read_contract_response controller_impl::read_contract( const rpc::ch
                  "missing expected field: ${f}",
                  ( "f", "contract_id" ) );
 
-  auto db_lock = _db.get_shared_lock();
+  auto pin  = pin_snapshot();
+  auto head = get_head_snapshot();
 
-  execution_context ctx( _vm_backend, intent::read_only );
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend, intent::read_only );
+  auto& ctx       = *pooled_ctx;
   ctx.push_frame( stack_frame{
     .call_privilege = privilege::user_mode,
   } );
 
-  std::shared_ptr< const protocol::block > head_block_ptr;
-
-  {
-    std::shared_lock< std::shared_mutex > head_lock( _cached_head_block_mutex );
-    head_block_ptr = _cached_head_block;
-    KOINOS_ASSERT( head_block_ptr, internal_error_exception, "error retrieving head block" );
-
-    ctx.set_state_node( _db.get_head( db_lock )->create_anonymous_node() );
-  }
-
-  ctx.set_block( *head_block_ptr );
-  ctx.reset_cache();
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  ctx.set_block( *head->block );
+  prepare_read_cache( ctx, *head );
 
   resource_limit_data rl;
   rl.set_compute_bandwidth_limit( _read_compute_bandwidth_limit );
@@ -1180,21 +1616,54 @@ controller_impl::get_account_nonce( const rpc::chain::get_account_nonce_request&
                  "missing expected field: ${f}",
                  ( "f", "account" ) );
 
-  execution_context ctx( _vm_backend );
+  auto pin  = pin_snapshot();
+  auto head = get_head_snapshot();
+
+  rpc::chain::get_account_nonce_response resp;
+
+  if( auto nonce = head->cache.account_nonce( request.account() ); nonce )
+  {
+    _read_cache_hits++;
+    resp.set_nonce( *nonce );
+    return resp;
+  }
+
+  _read_cache_misses++;
+
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend );
+  auto& ctx       = *pooled_ctx;
 
   ctx.push_frame( koinos::chain::stack_frame{ .call_privilege = privilege::kernel_mode } );
 
-  ctx.set_state_node( _db.get_head( _db.get_shared_lock() )->create_anonymous_node() );
-  ctx.reset_cache();
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  prepare_read_cache( ctx, *head );
 
   auto nonce = system_call::get_account_nonce( ctx, request.account() );
+  head->cache.set_account_nonce( request.account(), nonce );
 
-  rpc::chain::get_account_nonce_response resp;
   resp.set_nonce( nonce );
 
   return resp;
 }
 
+read_cache_stats controller_impl::get_read_cache_stats() const
+{
+  return read_cache_stats{ .hits = _read_cache_hits.load(), .misses = _read_cache_misses.load() };
+}
+
+vm_manager::module_cache_stats controller_impl::get_module_cache_stats() const
+{
+  return _vm_backend->get_module_cache_stats();
+}
+
+block_store_stats controller_impl::get_block_store_stats() const
+{
+  if( _block_store_writer )
+    return _block_store_writer->stats();
+
+  return {};
+}
+
 rpc::chain::invoke_system_call_response
 controller_impl::invoke_system_call( const rpc::chain::invoke_system_call_request& request )
 {
@@ -1203,7 +1672,9 @@ controller_impl::invoke_system_call( const rpc::chain::invoke_system_call_reques
                  "missing expected field: ${f1} or ${f2}",
                  ( "f1", "id" )( "f2", "name" ) );
 
-  execution_context ctx( _vm_backend, intent::read_only );
+  auto pin        = pin_snapshot();
+  auto pooled_ctx = execution_context_pool::acquire( _vm_backend, intent::read_only );
+  auto& ctx       = *pooled_ctx;
 
   stack_frame sframe;
 
@@ -1219,8 +1690,9 @@ controller_impl::invoke_system_call( const rpc::chain::invoke_system_call_reques
 
   ctx.push_frame( std::move( sframe ) );
 
-  ctx.set_state_node( _db.get_head( _db.get_shared_lock() )->create_anonymous_node() );
-  ctx.reset_cache();
+  auto head = get_head_snapshot();
+  ctx.set_state_node( head->node->create_anonymous_node() );
+  prepare_read_cache( ctx, *head );
 
   resource_limit_data rl;
   rl.set_compute_bandwidth_limit( _read_compute_bandwidth_limit );
@@ -1261,10 +1733,18 @@ controller_impl::invoke_system_call( const rpc::chain::invoke_system_call_reques
 
 controller::controller( uint64_t read_compute_bandwith_limit,
                         uint32_t syscall_bufsize,
-                        std::optional< uint64_t > pending_transaction_limit ):
+                        std::optional< uint64_t > pending_transaction_limit,
+                        uint64_t verification_threads,
+                        bool parallel_transactions,
+                        bool batch_events,
+                        uint64_t module_cache_size ):
     _my( std::make_unique< detail::controller_impl >( read_compute_bandwith_limit,
                                                       syscall_bufsize,
-                                                      pending_transaction_limit ) )
+                                                      pending_transaction_limit,
+                                                      verification_threads,
+                                                      parallel_transactions,
+                                                      batch_events,
+                                                      module_cache_size ) )
 {}
 
 controller::~controller() = default;
@@ -1378,4 +1858,37 @@ controller::invoke_system_call( const rpc::chain::invoke_system_call_request& re
   return _my->invoke_system_call( request );
 }
 
+read_cache_stats controller::get_read_cache_stats() const
+{
+  return _my->get_read_cache_stats();
+}
+
+vm_manager::module_cache_stats controller::get_module_cache_stats() const
+{
+  return _my->get_module_cache_stats();
+}
+
+block_store_stats controller::get_block_store_stats() const
+{
+  return _my->get_block_store_stats();
+}
+
+read_batch_guard controller::begin_read_batch()
+{
+  return read_batch_guard( _my->begin_read_batch() );
+}
+
+read_batch_guard::read_batch_guard( std::unique_ptr< detail::read_batch > batch ):
+    _batch( std::move( batch ) )
+{
+  _batch->previous           = detail::current_read_batch;
+  detail::current_read_batch = _batch.get();
+}
+
+read_batch_guard::~read_batch_guard()
+{
+  if( _batch )
+    detail::current_read_batch = _batch->previous;
+}
+
 } // namespace koinos::chain
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <koinos/chain/block_store_writer.hpp>
 #include <koinos/chain/constants.hpp>
+#include <koinos/chain/read_cache.hpp>
 #include <koinos/mq/client.hpp>
 #include <koinos/protocol/protocol.pb.h>
 #include <koinos/rpc/chain/chain_rpc.pb.h>
 #include <koinos/state_db/state_db_types.hpp>
+#include <koinos/vm_manager/vm_backend.hpp>
 
 #include <any>
 #include <chrono>
@@ -16,8 +19,29 @@ namespace koinos::chain {
 
 namespace detail {
 class controller_impl;
+struct read_batch;
 } // namespace detail
 
+/**
+ * Pins the head for the read requests made by the current thread for as long as it is alive.
+ *
+ * Pinned reads execute against the same state and share execution context caches, such as the
+ * descriptor pool, compute registry and system call table. A batch does not hold the database lock,
+ * so blocks are applied while it is alive, but committing LIB is deferred until it is destroyed.
+ * Guards must be destroyed in the reverse order of their creation, on the thread that created them.
+ */
+class read_batch_guard final
+{
+public:
+  read_batch_guard( std::unique_ptr< detail::read_batch > batch );
+  read_batch_guard( const read_batch_guard& ) = delete;
+  read_batch_guard( read_batch_guard&& )      = delete;
+  ~read_batch_guard();
+
+private:
+  std::unique_ptr< detail::read_batch > _batch;
+};
+
 enum class fork_resolution_algorithm
 {
   fifo,
@@ -30,7 +54,11 @@ class controller final
 public:
   controller( uint64_t read_compute_bandwith_limit                = 0,
               uint32_t syscall_bufsize                            = 0,
-              std::optional< uint64_t > pending_transaction_limit = {} );
+              std::optional< uint64_t > pending_transaction_limit = {},
+              uint64_t verification_threads                       = 0,
+              bool parallel_transactions                          = false,
+              bool batch_events                                   = false,
+              uint64_t module_cache_size                          = 0 );
   ~controller();
 
   void
@@ -57,6 +85,12 @@ public:
   rpc::chain::get_resource_limits_response get_resource_limits( const rpc::chain::get_resource_limits_request& );
   rpc::chain::invoke_system_call_response invoke_system_call( const rpc::chain::invoke_system_call_request& );
 
+  read_cache_stats get_read_cache_stats() const;
+  vm_manager::module_cache_stats get_module_cache_stats() const;
+  block_store_stats get_block_store_stats() const;
+
+  read_batch_guard begin_read_batch();
+
 private:
   std::unique_ptr< detail::controller_impl > _my;
 };
@@ -0,0 +1,29 @@
+#include <koinos/chain/dispatch_table.hpp>
+
+#include <mutex>
+
+namespace koinos::chain {
+
+std::optional< system_call_cache_entry > dispatch_table::find( uint32_t id ) const
+{
+  std::shared_lock< std::shared_mutex > lock( _mutex );
+
+  if( auto itr = _entries.find( id ); itr != _entries.end() )
+    return itr->second;
+
+  return {};
+}
+
+void dispatch_table::add( uint32_t id, const system_call_cache_entry& entry )
+{
+  std::unique_lock< std::shared_mutex > lock( _mutex );
+  _entries.try_emplace( id, entry );
+}
+
+std::size_t dispatch_table::size() const
+{
+  std::shared_lock< std::shared_mutex > lock( _mutex );
+  return _entries.size();
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <koinos/chain/chain.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <variant>
+
+namespace koinos::chain {
+
+struct system_call_cache_bundle
+{
+  std::string contract_id;
+  std::shared_ptr< const std::string > contract_bytecode;
+  uint32_t entry_point;
+  chain::contract_metadata_object contract_metadata;
+};
+
+struct thunk_cache_bundle
+{
+  uint32_t thunk_id;
+  bool is_override;
+};
+
+using system_call_cache_entry = std::variant< system_call_cache_bundle, thunk_cache_bundle >;
+
+/**
+ * How system calls are dispatched according to a finalized state node.
+ *
+ * A table is shared by every context executing on top of the node it was resolved from, and by the
+ * nodes descending from it that did not modify system call dispatch, contract metadata or bytecode.
+ * Overriding contracts are held as shared, immutable bytecode.
+ */
+class dispatch_table final
+{
+public:
+  std::optional< system_call_cache_entry > find( uint32_t id ) const;
+  void add( uint32_t id, const system_call_cache_entry& entry );
+
+  std::size_t size() const;
+
+private:
+  mutable std::shared_mutex _mutex;
+  std::map< uint32_t, system_call_cache_entry > _entries;
+};
+
+} // namespace koinos::chain
@@ -5,10 +5,77 @@
 #include <koinos/chain/types.hpp>
 #include <koinos/util/hex.hpp>
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 namespace koinos::chain {
 
+namespace {
+
+constexpr std::size_t max_cached_versions          = 8;
+constexpr std::size_t max_cached_contract_metadata = 1'024;
+
+/**
+ * Objects derived from metadata, such as descriptor pools and compute registries, are immutable once built,
+ * so a single object per version of the metadata is shared by every execution context in the process.
+ */
+template< typename T >
+class versioned_cache final
+{
+public:
+  template< typename Builder >
+  std::shared_ptr< const T > get( const std::string& metadata, Builder&& build )
+  {
+    auto key = util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, metadata ) );
+
+    {
+      std::lock_guard< std::mutex > lock( _mutex );
+      if( auto itr = _objects.find( key ); itr != _objects.end() )
+        return itr->second;
+    }
+
+    std::shared_ptr< const T > object = build( metadata );
+
+    std::lock_guard< std::mutex > lock( _mutex );
+
+    // Another context may have built the same object in the meantime
+    if( auto itr = _objects.find( key ); itr != _objects.end() )
+      return itr->second;
+
+    if( _keys.size() >= max_cached_versions )
+    {
+      _objects.erase( _keys.front() );
+      _keys.pop_front();
+    }
+
+    _keys.push_back( key );
+    return _objects.emplace( std::move( key ), std::move( object ) ).first->second;
+  }
+
+private:
+  std::mutex _mutex;
+  std::deque< std::string > _keys;
+  std::unordered_map< std::string, std::shared_ptr< const T > > _objects;
+};
+
+versioned_cache< google::protobuf::DescriptorPool >& descriptor_pools()
+{
+  static versioned_cache< google::protobuf::DescriptorPool > cache;
+  return cache;
+}
+
+versioned_cache< compute_registry >& compute_registries()
+{
+  static versioned_cache< compute_registry > cache;
+  return cache;
+}
+
+} // namespace
+
 execution_context::execution_context( std::shared_ptr< vm_manager::vm_backend > vm_backend, chain::intent i ):
-    _vm_backend( vm_backend )
+    _vm_backend( vm_backend ),
+    _cache( std::make_shared< execution_context_cache >() )
 {
   set_intent( i );
 }
@@ -18,6 +85,40 @@ std::shared_ptr< vm_manager::vm_backend > execution_context::get_backend() const
   return _vm_backend;
 }
 
+void execution_context::reset( std::shared_ptr< vm_manager::vm_backend > vm_backend, chain::intent i )
+{
+  _vm_backend = std::move( vm_backend );
+  _stack.clear();
+
+  clear_state_node();
+  clear_block();
+  clear_transaction();
+  clear_operation();
+  clear_mempool_nonce();
+
+  _resource_meter = chain::resource_meter();
+  _chronicler     = chain::chronicler();
+
+  set_intent( i );
+  _receipt = std::monostate();
+
+  // A cache shared with other contexts cannot be cleared from under them
+  if( _cache.use_count() > 1 )
+    _cache = std::make_shared< execution_context_cache >();
+  else
+    reset_cache();
+
+  invalidate_metadata_cache();
+  _result = execution_result();
+
+  _dispatch_table.reset();
+  _verification_memo.reset();
+  clear_worker_pool();
+  clear_state_access_log();
+
+  _failed_transaction_indices.clear();
+}
+
 void execution_context::set_state_node( abstract_state_node_ptr node, abstract_state_node_ptr parent )
 {
   _current_state_node = node;
@@ -228,11 +329,13 @@ void execution_context::build_compute_registry_cache()
 
   auto obj = parent_state_node->get_object( state::space::metadata(), state::key::compute_bandwidth_registry );
   KOINOS_ASSERT( obj, chain::reversion_exception, "compute bandwidth registry does not exist" );
-  auto compute_registry = util::converter::to< compute_bandwidth_registry >( *obj );
 
-  _cache.compute_bandwidth.emplace();
-  for( const auto& entry: compute_registry.entries() )
-    ( *_cache.compute_bandwidth )[ entry.name() ] = entry.compute();
+  _cache->compute_bandwidth = compute_registries().get(
+    *obj,
+    []( const std::string& registry )
+    {
+      return std::make_shared< compute_registry >( util::converter::to< compute_bandwidth_registry >( registry ) );
+    } );
 }
 
 void execution_context::build_descriptor_pool()
@@ -245,12 +348,21 @@ void execution_context::build_descriptor_pool()
   auto pdesc = parent_state_node->get_object( state::space::metadata(), state::key::protocol_descriptor );
   KOINOS_ASSERT( pdesc, chain::reversion_exception, "file descriptor set does not exist" );
 
-  google::protobuf::FileDescriptorSet fdesc;
-  KOINOS_ASSERT( fdesc.ParseFromString( *pdesc ), chain::reversion_exception, "file descriptor set is malformed" );
+  _cache->descriptor_pool = descriptor_pools().get(
+    *pdesc,
+    []( const std::string& descriptor )
+    {
+      google::protobuf::FileDescriptorSet fdesc;
+      KOINOS_ASSERT( fdesc.ParseFromString( descriptor ),
+                     chain::reversion_exception,
+                     "file descriptor set is malformed" );
+
+      auto pool = std::make_shared< google::protobuf::DescriptorPool >();
+      for( const auto& fd: fdesc.file() )
+        pool->BuildFile( fd );
 
-  _cache.descriptor_pool.emplace();
-  for( const auto& fd: fdesc.file() )
-    _cache.descriptor_pool->BuildFile( fd );
+      return pool;
+    } );
 }
 
 void execution_context::cache_system_call( uint32_t id )
@@ -260,9 +372,20 @@ void execution_context::cache_system_call( uint32_t id )
                  chain::reversion_exception,
                  "cannot build execution context cache without a state node" );
 
-  if( _cache.system_call_table.find( id ) != _cache.system_call_table.end() )
+  if( _cache->system_call_table.find( id ) != _cache->system_call_table.end() )
     return;
 
+  if( _dispatch_table )
+  {
+    if( auto entry = _dispatch_table->find( id ); entry )
+    {
+      _cache->system_call_table.emplace( id, std::move( *entry ) );
+      return;
+    }
+  }
+
+  system_call_cache_entry entry = thunk_cache_bundle{ id, false };
+
   auto obj =
     parent_state_node->get_object( state::space::system_call_dispatch(), util::converter::as< std::string >( id ) );
 
@@ -288,28 +411,22 @@ void execution_context::cache_system_call( uint32_t id )
                      "contract bytecode for call id ${id} not found",
                      ( "id", id ) );
 
-      auto success = _cache.system_call_table
-                       .emplace( id,
-                                 system_call_cache_bundle{
-                                   contract_id,
-                                   *contract_bytecode,
-                                   entry_point,
-                                   util::converter::to< chain::contract_metadata_object >( *contract_meta ) } )
-                       .second;
-      KOINOS_ASSERT( success, internal_error_exception, "caching system call ${id} failed", ( "id", id ) );
+      entry = system_call_cache_bundle{ contract_id,
+                                        std::make_shared< const std::string >( *contract_bytecode ),
+                                        entry_point,
+                                        util::converter::to< chain::contract_metadata_object >( *contract_meta ) };
     }
     else
     {
-      auto success =
-        _cache.system_call_table.emplace( id, thunk_cache_bundle{ system_call_target.thunk_id(), true } ).second;
-      KOINOS_ASSERT( success, internal_error_exception, "caching system call ${id} failed", ( "id", id ) );
+      entry = thunk_cache_bundle{ system_call_target.thunk_id(), true };
     }
   }
-  else
-  {
-    auto success = _cache.system_call_table.emplace( id, thunk_cache_bundle{ id, false } ).second;
-    KOINOS_ASSERT( success, internal_error_exception, "caching system call ${id} failed", ( "id", id ) );
-  }
+
+  if( _dispatch_table )
+    _dispatch_table->add( id, entry );
+
+  auto success = _cache->system_call_table.emplace( id, std::move( entry ) ).second;
+  KOINOS_ASSERT( success, internal_error_exception, "caching system call ${id} failed", ( "id", id ) );
 }
 
 void execution_context::build_block_hash_code_cache()
@@ -320,48 +437,116 @@ void execution_context::build_block_hash_code_cache()
   auto bhash = parent_state_node->get_object( state::space::metadata(), state::key::block_hash_code );
   KOINOS_ASSERT( bhash, invalid_contract_exception, "block hash code does not exist" );
 
-  _cache.block_hash_code.emplace( crypto::multicodec( util::converter::to< unsigned_varint >( *bhash ).value ) );
+  _cache->block_hash_code.emplace( crypto::multicodec( util::converter::to< unsigned_varint >( *bhash ).value ) );
+}
+
+void execution_context::set_cache( std::shared_ptr< execution_context_cache > cache )
+{
+  KOINOS_ASSERT( cache, internal_error_exception, "execution context cache cannot be null" );
+  _cache = std::move( cache );
 }
 
 void execution_context::reset_cache()
 {
-  _cache.compute_bandwidth.reset();
-  _cache.descriptor_pool.reset();
-  _cache.system_call_table.clear();
-  _cache.block_hash_code.reset();
+  _cache->compute_bandwidth.reset();
+  _cache->descriptor_pool.reset();
+  _cache->system_call_table.clear();
+  _cache->block_hash_code.reset();
+  _cache->contract_metadata.clear();
 }
 
-uint64_t execution_context::get_compute_bandwidth( const std::string& thunk_name )
+void execution_context::set_dispatch_table( std::shared_ptr< chain::dispatch_table > table )
+{
+  _dispatch_table = std::move( table );
+}
+
+void execution_context::set_verification_memo( std::shared_ptr< const chain::verification_memo > memo )
+{
+  _verification_memo = std::move( memo );
+}
+
+const std::shared_ptr< const verification_memo >& execution_context::verification_memo() const
+{
+  return _verification_memo;
+}
+
+void execution_context::set_worker_pool( chain::worker_pool& pool, state_db::shared_lock_ptr db_lock )
 {
-  if( !_cache.compute_bandwidth )
+  KOINOS_ASSERT( db_lock, internal_error_exception, "parallel execution requires a database lock" );
+  _worker_pool    = &pool;
+  _worker_db_lock = std::move( db_lock );
+}
+
+worker_pool* execution_context::get_worker_pool() const
+{
+  return _worker_pool;
+}
+
+const state_db::shared_lock_ptr& execution_context::get_worker_db_lock() const
+{
+  return _worker_db_lock;
+}
+
+void execution_context::clear_worker_pool()
+{
+  _worker_pool = nullptr;
+  _worker_db_lock.reset();
+}
+
+void execution_context::set_state_access_log( chain::state_access_log& log )
+{
+  _state_access_log = &log;
+}
+
+state_access_log* execution_context::state_access_log() const
+{
+  return _state_access_log;
+}
+
+void execution_context::clear_state_access_log()
+{
+  _state_access_log = nullptr;
+}
+
+const compute_registry& execution_context::get_compute_registry()
+{
+  if( !_cache->compute_bandwidth )
     build_compute_registry_cache();
 
-  auto itr = _cache.compute_bandwidth->find( thunk_name );
+  return *_cache->compute_bandwidth;
+}
 
-  KOINOS_ASSERT( itr != _cache.compute_bandwidth->end(),
-                 reversion_exception,
-                 "unable to find compute bandwidth for ${t}",
-                 ( "t", thunk_name ) );
+uint64_t execution_context::get_compute_bandwidth( const std::string& thunk_name )
+{
+  return get_compute_registry().compute( thunk_name );
+}
+
+uint64_t execution_context::get_compute_bandwidth( compute_cost cost )
+{
+  return get_compute_registry().compute( cost );
+}
 
-  return itr->second;
+uint64_t execution_context::get_thunk_compute_bandwidth( uint32_t thunk_id )
+{
+  return get_compute_registry().thunk_compute( thunk_id );
 }
 
 const google::protobuf::DescriptorPool& execution_context::descriptor_pool()
 {
-  if( !_cache.descriptor_pool )
+  if( !_cache->descriptor_pool )
     build_descriptor_pool();
 
-  return *_cache.descriptor_pool;
+  return *_cache->descriptor_pool;
 }
 
-const execution_result& execution_context::system_call( uint32_t id, const std::string& args )
+const execution_result& execution_context::system_call( uint32_t id, std::string args )
 {
   try
   {
     cache_system_call( id );
 
-    auto itr = _cache.system_call_table.find( id );
-    KOINOS_ASSERT( itr != _cache.system_call_table.end(),
+    auto itr = _cache->system_call_table.find( id );
+    KOINOS_ASSERT( itr != _cache->system_call_table.end(),
                    reversion_exception,
                    "unable to find call id ${id} in system call cache",
                    ( "id", id ) );
@@ -374,12 +559,17 @@ const execution_result& execution_context::system_call( uint32_t id, const std::
       stack_frame{ .contract_id = call_bundle->contract_id,
                    .call_privilege =
                      call_bundle->contract_metadata.system() ? privilege::kernel_mode : privilege::user_mode,
-                   .call_args   = args,
+                   .call_args   = std::move( args ),
                    .entry_point = call_bundle->entry_point },
       [ & ]
       {
         chain::host_api hapi( *this );
-        get_backend()->run( hapi, call_bundle->contract_bytecode, call_bundle->contract_metadata.hash() );
+        get_backend()->run( hapi, *call_bundle->contract_bytecode, call_bundle->contract_metadata.hash() );
+
+        if( hapi.exited() && _result.code >= reversion )
+          throw reversion_exception( _result.code, _result.res.error() );
+        if( hapi.exited() && _result.code <= failure )
+          throw failure_exception( _result.code, _result.res.error() );
       } );
   }
   catch( const success_exception& )
@@ -392,8 +582,8 @@ bool execution_context::system_call_exists( uint32_t id )
 {
   cache_system_call( id );
 
-  auto itr = _cache.system_call_table.find( id );
-  if( itr == _cache.system_call_table.end() )
+  auto itr = _cache->system_call_table.find( id );
+  if( itr == _cache->system_call_table.end() )
     return false;
 
   return std::get_if< system_call_cache_bundle >( &itr->second ) != nullptr;
@@ -403,8 +593,8 @@ uint32_t execution_context::thunk_translation( uint32_t id )
 {
   cache_system_call( id );
 
-  auto itr = _cache.system_call_table.find( id );
-  KOINOS_ASSERT( itr != _cache.system_call_table.end(),
+  auto itr = _cache->system_call_table.find( id );
+  KOINOS_ASSERT( itr != _cache->system_call_table.end(),
                  reversion_exception,
                  "unable to find call id ${id} in system call cache",
                  ( "id", id ) );
@@ -433,10 +623,49 @@ uint32_t execution_context::thunk_translation( uint32_t id )
 
 const crypto::multicodec& execution_context::block_hash_code()
 {
-  if( !_cache.block_hash_code )
+  if( !_cache->block_hash_code )
     build_block_hash_code_cache();
 
-  return *_cache.block_hash_code;
+  return *_cache->block_hash_code;
+}
+
+std::shared_ptr< const contract_metadata_object > execution_context::contract_metadata( const std::string& contract_id,
+                                                                                        const std::string& serialized )
+{
+  if( auto itr = _cache->contract_metadata.find( contract_id ); itr != _cache->contract_metadata.end() )
+  {
+    if( itr->second.first == serialized )
+      return itr->second.second;
+  }
+
+  auto meta = std::make_shared< const contract_metadata_object >(
+    util::converter::to< contract_metadata_object >( serialized ) );
+
+  if( _cache->contract_metadata.size() >= max_cached_contract_metadata )
+    _cache->contract_metadata.clear();
+
+  _cache->contract_metadata.insert_or_assign( contract_id, std::make_pair( serialized, meta ) );
+
+  return meta;
+}
+
+metadata_cache& execution_context::cached_metadata()
+{
+  return _metadata_cache;
+}
+
+void execution_context::invalidate_metadata_cache()
+{
+  _metadata_cache = chain::metadata_cache();
+}
+
+bool execution_context::state_node_is_visible( const std::weak_ptr< abstract_state_node >& node ) const
+{
+  auto n = node.lock();
+  if( !n || !_current_state_node )
+    return false;
+
+  return n == _current_state_node || n == _current_state_node->parent();
 }
 
 void execution_context::set_result( const execution_result& r )
@@ -464,4 +693,34 @@ const std::vector< uint32_t >& execution_context::get_failed_transaction_indices
   return _failed_transaction_indices;
 }
 
+namespace {
+
+thread_local std::vector< std::unique_ptr< execution_context > > pooled_contexts;
+
+} // namespace
+
+void execution_context_pool::releaser::operator()( execution_context* ctx ) const
+{
+  std::unique_ptr< execution_context > context( ctx );
+
+  // Resetting drops the references the context holds to state, even when it is not kept
+  context->reset( nullptr );
+
+  if( pooled_contexts.size() < max_pooled_contexts )
+    pooled_contexts.emplace_back( std::move( context ) );
+}
+
+execution_context_pool::pooled_context
+execution_context_pool::acquire( std::shared_ptr< vm_manager::vm_backend > vm_backend, chain::intent i )
+{
+  if( pooled_contexts.empty() )
+    return pooled_context( new execution_context( std::move( vm_backend ), i ) );
+
+  auto context = std::move( pooled_contexts.back() );
+  pooled_contexts.pop_back();
+
+  context->reset( std::move( vm_backend ), i );
+  return pooled_context( context.release() );
+}
+
 } // namespace koinos::chain
@@ -3,9 +3,13 @@
 #include <google/protobuf/descriptor.h>
 
 #include <koinos/chain/chronicler.hpp>
+#include <koinos/chain/compute_registry.hpp>
+#include <koinos/chain/dispatch_table.hpp>
 #include <koinos/chain/exceptions.hpp>
 #include <koinos/chain/resource_meter.hpp>
 #include <koinos/chain/session.hpp>
+#include <koinos/chain/verification_memo.hpp>
+#include <koinos/chain/worker_pool.hpp>
 #include <koinos/crypto/elliptic.hpp>
 #include <koinos/state_db/state_db.hpp>
 #include <koinos/vm_manager/vm_backend.hpp>
@@ -25,6 +29,8 @@
 
 namespace koinos::chain {
 
+class state_access_log;
+
 namespace constants {
 const std::string system = std::string{};
 } // namespace constants
@@ -59,26 +65,37 @@ enum class intent : uint64_t
   block_proposal
 };
 
-struct system_call_cache_bundle
+using contract_metadata_cache =
+  std::map< std::string, std::pair< std::string, std::shared_ptr< const contract_metadata_object > > >;
+
+struct execution_context_cache
 {
-  std::string contract_id;
-  std::string contract_bytecode;
-  uint32_t entry_point;
-  chain::contract_metadata_object contract_metadata;
+  std::shared_ptr< const compute_registry > compute_bandwidth;
+  std::shared_ptr< const google::protobuf::DescriptorPool > descriptor_pool;
+  std::map< uint32_t, system_call_cache_entry > system_call_table;
+  std::optional< crypto::multicodec > block_hash_code;
+  contract_metadata_cache contract_metadata;
 };
 
-struct thunk_cache_bundle
+template< typename T >
+struct cached_metadata_object
 {
-  uint32_t thunk_id;
-  bool is_override;
+  T value;
+  std::size_t size = 0; // Size of the serialized object, so that reading it can still be charged
+  std::weak_ptr< abstract_state_node > node; // The state node the object was read from
 };
 
-struct execution_context_cache
+/**
+ * Kernel metadata objects parsed while applying the current block. Entries are dropped whenever the metadata
+ * space is written to, and an entry is only used while the node it was read from is the current state node or its
+ * parent. An object read in a transaction's node is therefore not seen once that node is reverted or discarded.
+ */
+struct metadata_cache
 {
-  std::optional< std::map< std::string, uint64_t > > compute_bandwidth;
-  std::optional< google::protobuf::DescriptorPool > descriptor_pool;
-  std::map< uint32_t, std::variant< system_call_cache_bundle, thunk_cache_bundle > > system_call_table;
-  std::optional< crypto::multicodec > block_hash_code;
+  std::optional< cached_metadata_object< std::string > > chain_id;
+  std::optional< cached_metadata_object< std::string > > genesis_key;
+  std::optional< cached_metadata_object< chain::max_account_resources > > max_account_resources;
+  std::optional< cached_metadata_object< resource_limit_data > > resource_limits;
 };
 
 class execution_context
@@ -91,6 +108,9 @@ public:
 
   std::shared_ptr< vm_manager::vm_backend > get_backend() const;
 
+  // Returns the context to the state of a newly constructed one, keeping the capacity of its containers
+  void reset( std::shared_ptr< vm_manager::vm_backend > vm_backend, chain::intent i = chain::intent::read_only );
+
   void set_state_node( abstract_state_node_ptr, abstract_state_node_ptr = abstract_state_node_ptr() );
   abstract_state_node_ptr get_state_node() const;
   abstract_state_node_ptr get_parent_node() const;
@@ -117,7 +137,10 @@ public:
 
   uint32_t get_contract_entry_point() const;
 
+  const compute_registry& get_compute_registry();
   uint64_t get_compute_bandwidth( const std::string& thunk_name );
+  uint64_t get_compute_bandwidth( compute_cost cost );
+  uint64_t get_thunk_compute_bandwidth( uint32_t thunk_id );
 
   void push_frame( stack_frame&& frame );
   stack_frame pop_frame();
@@ -145,13 +168,43 @@ public:
 
   void reset_cache();
 
+  // Shares the cache with other contexts executing against the same state
+  void set_cache( std::shared_ptr< execution_context_cache > cache );
+
+  // When set, system call dispatch is resolved through a table shared with other contexts on the same parent node
+  void set_dispatch_table( std::shared_ptr< chain::dispatch_table > table );
+
+  void set_verification_memo( std::shared_ptr< const chain::verification_memo > memo );
+  const std::shared_ptr< const chain::verification_memo >& verification_memo() const;
+
+  // When set, apply_block speculatively executes transactions in parallel on the worker pool. The workers read
+  // state from other threads, so they hold the shared database lock the caller executes the block under.
+  void set_worker_pool( chain::worker_pool& pool, state_db::shared_lock_ptr db_lock );
+  chain::worker_pool* get_worker_pool() const;
+  const state_db::shared_lock_ptr& get_worker_db_lock() const;
+  void clear_worker_pool();
+
+  void set_state_access_log( chain::state_access_log& log );
+  chain::state_access_log* state_access_log() const;
+  void clear_state_access_log();
+
   const google::protobuf::DescriptorPool& descriptor_pool();
 
-  const execution_result& system_call( uint32_t id, const std::string& args );
+  const execution_result& system_call( uint32_t id, std::string args );
   uint32_t thunk_translation( uint32_t id );
   bool system_call_exists( uint32_t id );
   const crypto::multicodec& block_hash_code();
 
+  // Parses contract metadata, reusing the previous parse while the serialized metadata is unchanged
+  std::shared_ptr< const contract_metadata_object > contract_metadata( const std::string& contract_id,
+                                                                       const std::string& serialized );
+
+  chain::metadata_cache& cached_metadata();
+  void invalidate_metadata_cache();
+
+  // Whether objects read from node are still visible, that is node is the current state node or its parent
+  bool state_node_is_visible( const std::weak_ptr< abstract_state_node >& node ) const;
+
   void set_result( const execution_result& r );
   void set_result( execution_result&& r );
 
@@ -183,12 +236,39 @@ private:
   chain::intent _intent;
   chain::receipt _receipt;
 
-  execution_context_cache _cache;
+  std::shared_ptr< execution_context_cache > _cache;
+  chain::metadata_cache _metadata_cache;
   execution_result _result;
 
+  std::shared_ptr< chain::dispatch_table > _dispatch_table;
+  std::shared_ptr< const chain::verification_memo > _verification_memo;
+  chain::worker_pool* _worker_pool           = nullptr;
+  state_db::shared_lock_ptr _worker_db_lock;
+  chain::state_access_log* _state_access_log = nullptr;
+
   std::vector< uint32_t > _failed_transaction_indices;
 };
 
+/**
+ * Execution contexts kept by the calling thread for reuse. Contexts are reset when they are released, so
+ * nothing from one use, including state nodes and caches, is visible to the next.
+ */
+class execution_context_pool final
+{
+public:
+  static constexpr std::size_t max_pooled_contexts = 16;
+
+  struct releaser
+  {
+    void operator()( execution_context* ctx ) const;
+  };
+
+  using pooled_context = std::unique_ptr< execution_context, releaser >;
+
+  static pooled_context acquire( std::shared_ptr< vm_manager::vm_backend > vm_backend,
+                                 chain::intent i = chain::intent::read_only );
+};
+
 namespace detail {
 
 struct frame_guard
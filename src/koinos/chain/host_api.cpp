@@ -50,7 +50,9 @@ int32_t host_api::invoke_thunk( uint32_t tid,
     if( code <= chain::failure )
       throw failure_exception( code, error );
 
-    throw success_exception( code );
+    // The exit thunk has already recorded the result, so the contract stops without unwinding the VM
+    _exited = true;
+    return code;
   }
 
   if( code != chain::success )
@@ -89,8 +91,7 @@ void host_api::call( uint32_t sid,
     {
       if( _ctx.system_call_exists( sid ) )
       {
-        std::string args( arg_ptr, arg_len );
-        auto exec_res = _ctx.system_call( sid, args );
+        const auto& exec_res = _ctx.system_call( sid, std::string( arg_ptr, arg_len ) );
 
         if( exec_res.res.has_object() )
         {
@@ -109,11 +110,7 @@ void host_api::call( uint32_t sid,
                        unknown_thunk_exception,
                        "thunk ${tid} does not exist",
                        ( "tid", thunk_id ) );
-        auto desc       = chain::system_call_id_descriptor();
-        auto enum_value = desc->FindValueByNumber( thunk_id );
-        KOINOS_ASSERT( enum_value, unknown_thunk_exception, "unrecognized thunk id ${id}", ( "id", thunk_id ) );
-        auto compute = _ctx.get_compute_bandwidth( enum_value->name() );
-        _ctx.resource_meter().use_compute_bandwidth( compute );
+        _ctx.resource_meter().use_compute_bandwidth( _ctx.get_thunk_compute_bandwidth( thunk_id ) );
         thunk_dispatcher::instance().call_thunk( thunk_id, _ctx, ret_ptr, ret_len, arg_ptr, arg_len, bytes_written );
       }
     } );
@@ -149,7 +146,9 @@ int32_t host_api::invoke_system_call( uint32_t sid,
     if( code <= failure )
       throw failure_exception( code, error );
 
-    throw success_exception();
+    // The exit thunk has already recorded the result, so the contract stops without unwinding the VM
+    _exited = true;
+    return code;
   }
 
   if( code != chain::success )
@@ -197,4 +196,9 @@ void host_api::use_meter_ticks( uint64_t meter_ticks )
   }
 }
 
+bool host_api::exited() const
+{
+  return _exited;
+}
+
 } // namespace koinos::chain
@@ -31,6 +31,10 @@ public:
                                       uint32_t* bytes_written ) override;
   virtual int64_t get_meter_ticks() const override;
   virtual void use_meter_ticks( uint64_t meter_ticks ) override;
+  virtual bool exited() const override;
+
+private:
+  bool _exited = false;
 };
 
 } // namespace koinos::chain
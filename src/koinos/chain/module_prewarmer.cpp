@@ -0,0 +1,191 @@
+#include <koinos/chain/module_prewarmer.hpp>
+
+#include <koinos/log.hpp>
+#include <koinos/util/hex.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iterator>
+
+namespace koinos::chain {
+
+module_prewarmer::module_prewarmer( std::shared_ptr< vm_manager::vm_backend > backend, std::size_t max_queued ):
+    _backend( std::move( backend ) ),
+    _max_queued( std::max( max_queued, std::size_t( 1 ) ) )
+{
+  _thread = std::thread(
+    [ this ]()
+    {
+      run();
+    } );
+}
+
+module_prewarmer::~module_prewarmer()
+{
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+    _stopping = true;
+    _queued -= _queue.size();
+    _queue.clear();
+  }
+
+  _cv.notify_all();
+  _thread.join();
+}
+
+void module_prewarmer::prewarm( std::string id, std::string bytecode )
+{
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+
+    if( _stopping || _queued >= _max_queued )
+      return;
+
+    _queue.emplace_back( std::move( id ), std::move( bytecode ) );
+    _queued++;
+  }
+
+  _cv.notify_all();
+}
+
+void module_prewarmer::flush()
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _queued == 0;
+            } );
+}
+
+void module_prewarmer::run()
+{
+  while( true )
+  {
+    std::pair< std::string, std::string > item;
+
+    {
+      std::unique_lock< std::mutex > lock( _mutex );
+      _cv.wait( lock,
+                [ & ]()
+                {
+                  return _stopping || !_queue.empty();
+                } );
+
+      // Prewarming is an optimization, anything still queued is dropped when stopping
+      if( _stopping )
+        return;
+
+      item = std::move( _queue.front() );
+      _queue.pop_front();
+    }
+
+    try
+    {
+      _backend->prewarm( item.first, item.second );
+    }
+    catch( const std::exception& e )
+    {
+      LOG( debug ) << "Failed to prewarm module " << util::to_hex( item.first ) << ": " << e.what();
+    }
+
+    {
+      std::lock_guard< std::mutex > lock( _mutex );
+      _queued--;
+    }
+
+    _cv.notify_all();
+  }
+}
+
+void module_prewarmer::record_call( const std::string& contract_id )
+{
+  std::lock_guard< std::mutex > lock( _calls_mutex );
+
+  if( _calls.size() >= max_tracked_contracts && _calls.find( contract_id ) == _calls.end() )
+  {
+    for( auto itr = _calls.begin(); itr != _calls.end(); )
+    {
+      itr->second /= 2;
+      itr = itr->second ? std::next( itr ) : _calls.erase( itr );
+    }
+  }
+
+  _calls[ contract_id ]++;
+}
+
+std::vector< std::string > module_prewarmer::hottest( std::size_t n ) const
+{
+  std::vector< std::pair< std::string, uint64_t > > calls;
+
+  {
+    std::lock_guard< std::mutex > lock( _calls_mutex );
+    calls.assign( _calls.begin(), _calls.end() );
+  }
+
+  n = std::min( n, calls.size() );
+  std::partial_sort( calls.begin(),
+                     calls.begin() + n,
+                     calls.end(),
+                     []( const auto& a, const auto& b )
+                     {
+                       return a.second > b.second;
+                     } );
+
+  std::vector< std::string > contract_ids;
+  contract_ids.reserve( n );
+
+  for( std::size_t i = 0; i < n; i++ )
+    contract_ids.emplace_back( std::move( calls[ i ].first ) );
+
+  return contract_ids;
+}
+
+std::vector< std::string > module_prewarmer::read_hot_contracts( const std::filesystem::path& p )
+{
+  std::vector< std::string > contract_ids;
+
+  std::ifstream ifs( p );
+  std::string line;
+
+  while( std::getline( ifs, line ) )
+  {
+    if( line.empty() )
+      continue;
+
+    try
+    {
+      contract_ids.emplace_back( util::from_hex< std::string >( line ) );
+    }
+    catch( const std::exception& e )
+    {
+      LOG( warning ) << "Ignoring malformed hot contract entry in " << p.string() << ": " << e.what();
+    }
+  }
+
+  return contract_ids;
+}
+
+void module_prewarmer::write_hot_contracts( const std::filesystem::path& p, std::size_t n ) const
+{
+  auto contract_ids = hottest( n );
+
+  // Write to a temporary file first so that a crash never leaves a partial list behind
+  auto tmp = p;
+  tmp += ".tmp";
+
+  {
+    std::ofstream ofs( tmp, std::ios::trunc );
+    for( const auto& contract_id: contract_ids )
+      ofs << util::to_hex( contract_id ) << '\n';
+  }
+
+  std::error_code ec;
+  std::filesystem::rename( tmp, p, ec );
+
+  if( ec )
+    LOG( warning ) << "Failed to write hot contracts to " << p.string() << ": " << ec.message();
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <koinos/vm_manager/vm_backend.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace koinos::chain {
+
+/**
+ * Parses contract modules into the VM backend's module cache on its own thread, ahead of their first call.
+ *
+ * Prewarming is best effort. At most max_queued modules are waiting at any time, modules beyond that are
+ * dropped rather than holding up the caller, and modules the backend fails to parse are ignored.
+ *
+ * Calls are counted per contract so that the most called contracts can be persisted and prewarmed again when
+ * the node restarts. Counts are halved whenever more than max_tracked_contracts are being tracked.
+ */
+class module_prewarmer final
+{
+public:
+  static constexpr std::size_t default_max_queued    = 64;
+  static constexpr std::size_t max_tracked_contracts = 4'096;
+
+  module_prewarmer( std::shared_ptr< vm_manager::vm_backend > backend, std::size_t max_queued = default_max_queued );
+  ~module_prewarmer();
+
+  void prewarm( std::string id, std::string bytecode );
+
+  // Blocks until everything queued so far has been prewarmed
+  void flush();
+
+  void record_call( const std::string& contract_id );
+  std::vector< std::string > hottest( std::size_t n ) const;
+
+  // The hot contracts file holds one hex encoded contract id per line, hottest first
+  static std::vector< std::string > read_hot_contracts( const std::filesystem::path& p );
+  void write_hot_contracts( const std::filesystem::path& p, std::size_t n ) const;
+
+private:
+  void run();
+
+  std::shared_ptr< vm_manager::vm_backend > _backend;
+  std::size_t _max_queued;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque< std::pair< std::string, std::string > > _queue;
+  std::size_t _queued = 0;
+  bool _stopping      = false;
+
+  mutable std::mutex _calls_mutex;
+  std::unordered_map< std::string, uint64_t > _calls;
+
+  std::thread _thread;
+};
+
+} // namespace koinos::chain
@@ -0,0 +1,246 @@
+#include <koinos/chain/exceptions.hpp>
+#include <koinos/chain/parallel_executor.hpp>
+#include <koinos/chain/system_calls.hpp>
+
+#include <koinos/util/conversion.hpp>
+
+#include <atomic>
+
+namespace koinos::chain {
+
+namespace {
+
+std::atomic< uint64_t > committed_transactions = 0;
+std::atomic< uint64_t > fallback_transactions  = 0;
+
+bool matches( const std::optional< std::string >& expected, const state_db::object_value* actual )
+{
+  if( !expected )
+    return actual == nullptr;
+
+  return actual != nullptr && *actual == *expected;
+}
+
+} // namespace
+
+state_access_log::state_access_log( abstract_state_node_ptr base ):
+    _base( std::move( base ) )
+{}
+
+void state_access_log::record_object( const object_space& space, const std::string& key )
+{
+  auto [ itr, inserted ] =
+    _objects.try_emplace( std::make_pair( util::converter::as< std::string >( space ), key ), object_entry() );
+
+  if( !inserted )
+    return;
+
+  itr->second.space = space;
+
+  if( const auto* value = _base->get_object( space, key ); value != nullptr )
+    itr->second.value = *value;
+}
+
+void state_access_log::record_next_object( const object_space& space,
+                                           const std::string& key,
+                                           const state_db::object_value* result,
+                                           const std::string& result_key )
+{
+  record_range( space, key, true, result, result_key );
+}
+
+void state_access_log::record_prev_object( const object_space& space,
+                                           const std::string& key,
+                                           const state_db::object_value* result,
+                                           const std::string& result_key )
+{
+  record_range( space, key, false, result, result_key );
+}
+
+void state_access_log::record_range( const object_space& space,
+                                     const std::string& key,
+                                     bool next,
+                                     const state_db::object_value* result,
+                                     const std::string& result_key )
+{
+  const auto [ base_result, base_key ] = next ? _base->get_next_object( space, key )
+                                              : _base->get_prev_object( space, key );
+
+  // A result shaped by the transaction's own writes can not be validated against another node
+  if( ( result == nullptr ) != ( base_result == nullptr )
+      || ( result != nullptr && ( *result != *base_result || result_key != base_key ) ) )
+  {
+    _conflict = true;
+    return;
+  }
+
+  range_entry entry{ .space = space, .key = key, .next = next };
+
+  if( base_result != nullptr )
+  {
+    entry.value      = *base_result;
+    entry.result_key = base_key;
+  }
+
+  _ranges.emplace_back( std::move( entry ) );
+}
+
+bool state_access_log::validate( abstract_state_node_ptr node ) const
+{
+  if( _conflict )
+    return false;
+
+  for( const auto& [ id, entry ]: _objects )
+  {
+    if( !matches( entry.value, node->get_object( entry.space, id.second ) ) )
+      return false;
+  }
+
+  for( const auto& entry: _ranges )
+  {
+    const auto [ result, result_key ] = entry.next ? node->get_next_object( entry.space, entry.key )
+                                                   : node->get_prev_object( entry.space, entry.key );
+
+    if( !matches( entry.value, result ) || ( result != nullptr && result_key != entry.result_key ) )
+      return false;
+  }
+
+  return true;
+}
+
+parallel_executor::parallel_executor( execution_context& context, const protocol::block& block, worker_pool& pool ):
+    _context( context ),
+    _block( block ),
+    _pool( pool ),
+    _db_lock( context.get_worker_db_lock() )
+{
+  KOINOS_ASSERT( _db_lock, internal_error_exception, "parallel execution requires a database lock" );
+}
+
+parallel_executor::~parallel_executor() = default;
+
+void parallel_executor::execute()
+{
+  auto block_node = _context.get_state_node();
+  KOINOS_ASSERT( block_node, internal_error_exception, "current state node does not exist" );
+
+  _transactions.clear();
+  _transactions.reserve( _block.transactions_size() );
+
+  // Contexts are acquired and released on this thread, so they come from and return to its pool
+  for( int i = 0; i < _block.transactions_size(); i++ )
+  {
+    _transactions.emplace_back( std::make_unique< speculative_transaction >( speculative_transaction{
+      .node       = block_node->create_anonymous_node(),
+      .access_log = block_node,
+      .context    = execution_context_pool::acquire( _context.get_backend(), intent::block_application ) } ) );
+  }
+
+  _pool.parallel_for( _transactions.size(),
+                      [ & ]( std::size_t i )
+                      {
+                        speculate( *_transactions[ i ], _block.transactions( int( i ) ) );
+                      } );
+}
+
+void parallel_executor::speculate( speculative_transaction& trx, const protocol::transaction& t )
+{
+  auto& ctx = *trx.context;
+
+  // Mirror the stack of apply_block so that the transaction sees the same callers
+  ctx.push_frame( stack_frame{ .call_privilege = privilege::kernel_mode } );
+  ctx.push_frame( stack_frame{ .sid = system_call_id::apply_block, .call_privilege = privilege::kernel_mode } );
+
+  ctx.set_state_node( trx.node, _context.get_parent_node() );
+  ctx.set_block( _block );
+  ctx.set_verification_memo( _context.verification_memo() );
+  ctx.set_state_access_log( trx.access_log );
+  ctx.resource_meter().set_resource_limit_data( _context.resource_meter().get_resource_limit_data() );
+  ctx.receipt() = protocol::block_receipt();
+
+  try
+  {
+    system_call::apply_transaction( ctx, t );
+    trx.completed = true;
+  }
+  catch( const reversion_exception& )
+  {
+    trx.completed = true;
+  }
+  catch( ... )
+  {
+    // Failures are reported when the transaction is applied serially
+  }
+
+  ctx.clear_state_access_log();
+}
+
+bool parallel_executor::commit( std::size_t i )
+{
+  bool committed = try_commit( i );
+
+  if( committed )
+    committed_transactions++;
+  else
+    fallback_transactions++;
+
+  return committed;
+}
+
+parallel_execution_stats parallel_executor::stats()
+{
+  return parallel_execution_stats{ .committed = committed_transactions.load(),
+                                   .fallbacks = fallback_transactions.load() };
+}
+
+bool parallel_executor::try_commit( std::size_t i )
+{
+  KOINOS_ASSERT( i < _transactions.size(), internal_error_exception, "transaction index out of range" );
+  KOINOS_ASSERT( std::holds_alternative< protocol::block_receipt >( _context.receipt() ),
+                 internal_error_exception,
+                 "expected block receipt with block application intent" );
+
+  auto trx = std::move( _transactions[ i ] );
+
+  if( !trx || !trx->completed )
+    return false;
+
+  auto& speculative_receipt = std::get< protocol::block_receipt >( trx->context->receipt() );
+  if( speculative_receipt.transaction_receipts_size() != 1 )
+    return false;
+
+  auto& meter           = _context.resource_meter();
+  const auto& trx_meter = trx->context->resource_meter();
+  auto block_node       = _context.get_state_node();
+
+  if( !meter.can_merge( trx_meter ) || !trx->access_log.validate( block_node ) )
+    return false;
+
+  const auto sequence_offset = _context.chronicler().events().size();
+
+  // The transaction receipt records disk storage relative to the block, which is only known now
+  auto start_disk_used = meter.disk_storage_used();
+  meter.merge_session_usage( trx_meter );
+  auto disk_storage_used = meter.disk_storage_used() - start_disk_used;
+  meter.merge_system_usage( trx_meter );
+
+  // The transaction may have written metadata without going through this context
+  trx->node->commit();
+  _context.invalidate_metadata_cache();
+  _context.chronicler().merge( std::move( trx->context->chronicler() ) );
+
+  auto* receipt = std::get< protocol::block_receipt >( _context.receipt() ).add_transaction_receipts();
+  receipt->Swap( speculative_receipt.mutable_transaction_receipts( 0 ) );
+  receipt->set_disk_storage_used( disk_storage_used );
+
+  for( auto& ev: *receipt->mutable_events() )
+    ev.set_sequence( ev.sequence() + sequence_offset );
+
+  receipt->clear_state_delta_entries();
+  for( const auto& entry: block_node->get_delta_entries() )
+    *receipt->add_state_delta_entries() = entry;
+
+  return true;
+}
+
+} // namespace koinos::chain
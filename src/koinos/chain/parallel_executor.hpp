@@ -0,0 +1,129 @@
+#pragma once
+
+#include <koinos/chain/execution_context.hpp>
+#include <koinos/chain/worker_pool.hpp>
+#include <koinos/state_db/state_db.hpp>
+
+#include <koinos/chain/chain.pb.h>
+#include <koinos/protocol/protocol.pb.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace koinos::chain {
+
+/**
+ * Records the state a speculatively executed transaction depended on.
+ *
+ * Every object the transaction touched is recorded with the value it had in the base node the
+ * transaction was executed on, along with the result of every range query. If a node returns the
+ * same values, the transaction would have behaved identically had it been executed on that node.
+ */
+class state_access_log final
+{
+public:
+  state_access_log( abstract_state_node_ptr base );
+
+  void record_object( const object_space& space, const std::string& key );
+  void record_next_object( const object_space& space,
+                           const std::string& key,
+                           const state_db::object_value* result,
+                           const std::string& result_key );
+  void record_prev_object( const object_space& space,
+                           const std::string& key,
+                           const state_db::object_value* result,
+                           const std::string& result_key );
+
+  bool validate( abstract_state_node_ptr node ) const;
+
+private:
+  struct object_entry
+  {
+    object_space space;
+    std::optional< std::string > value;
+  };
+
+  struct range_entry
+  {
+    object_space space;
+    std::string key;
+    bool next;
+    std::optional< std::string > value;
+    std::string result_key;
+  };
+
+  void record_range( const object_space& space,
+                     const std::string& key,
+                     bool next,
+                     const state_db::object_value* result,
+                     const std::string& result_key );
+
+  abstract_state_node_ptr _base;
+  std::map< std::pair< std::string, std::string >, object_entry > _objects;
+  std::vector< range_entry > _ranges;
+  bool _conflict = false;
+};
+
+struct parallel_execution_stats
+{
+  uint64_t committed = 0;
+  uint64_t fallbacks = 0;
+};
+
+/**
+ * Applies the transactions of a block in the style of Block-STM.
+ *
+ * Every transaction is first executed speculatively across the worker pool on its own execution
+ * context and anonymous state node. Transactions are then committed in block order, provided that
+ * the state they read is unchanged by the transactions committed before them and that their
+ * resource usage fits within what remains of the block. Anything else is applied serially, so the
+ * receipts, events and state deltas are identical to those of serial application.
+ *
+ * Workers only read the block node and its ancestors and write to their own anonymous nodes. The executor
+ * holds the shared database lock the block is applied under until it is destroyed, so no node the workers
+ * read from can be committed or discarded underneath them.
+ */
+class parallel_executor final
+{
+public:
+  parallel_executor( execution_context& context, const protocol::block& block, worker_pool& pool );
+  ~parallel_executor();
+
+  void execute();
+
+  /**
+   * Commits the speculative result of the i-th transaction to the context.
+   *
+   * Returns false when the result cannot be committed, in which case the transaction must be
+   * applied serially.
+   */
+  bool commit( std::size_t i );
+
+  // Transactions committed from their speculative result and those applied serially instead, across all executors
+  static parallel_execution_stats stats();
+
+private:
+  struct speculative_transaction
+  {
+    anonymous_state_node_ptr node;
+    state_access_log access_log;
+    execution_context_pool::pooled_context context;
+    bool completed = false;
+  };
+
+  void speculate( speculative_transaction& trx, const protocol::transaction& t );
+  bool try_commit( std::size_t i );
+
+  execution_context& _context;
+  const protocol::block& _block;
+  worker_pool& _pool;
+  state_db::shared_lock_ptr _db_lock;
+  std::vector< std::unique_ptr< speculative_transaction > > _transactions;
+};
+
+} // namespace koinos::chain
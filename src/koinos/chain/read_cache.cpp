@@ -0,0 +1,95 @@
+#include <koinos/chain/read_cache.hpp>
+
+#include <algorithm>
+
+namespace koinos::chain {
+
+read_cache::read_cache( std::size_t max_accounts ):
+    _max_accounts( std::max( max_accounts, std::size_t( 1 ) ) )
+{}
+
+std::optional< std::string > read_cache::chain_id()
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _chain_id;
+}
+
+void read_cache::set_chain_id( const std::string& id )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  _chain_id = id;
+}
+
+std::optional< resource_limit_data > read_cache::resource_limits()
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _resource_limits;
+}
+
+void read_cache::set_resource_limits( const resource_limit_data& limits )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  _resource_limits = limits;
+}
+
+std::optional< uint64_t > read_cache::account_rc( const std::string& account )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+
+  if( auto* entry = find_account( account ); entry != nullptr )
+    return entry->rc;
+
+  return {};
+}
+
+void read_cache::set_account_rc( const std::string& account, uint64_t rc )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  insert_account( account ).rc = rc;
+}
+
+std::optional< std::string > read_cache::account_nonce( const std::string& account )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+
+  if( auto* entry = find_account( account ); entry != nullptr )
+    return entry->nonce;
+
+  return {};
+}
+
+void read_cache::set_account_nonce( const std::string& account, const std::string& nonce )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  insert_account( account ).nonce = nonce;
+}
+
+read_cache::account_entry* read_cache::find_account( const std::string& account )
+{
+  auto itr = _account_map.find( account );
+  if( itr == _account_map.end() )
+    return nullptr;
+
+  // Move the entry to the front of the list
+  _lru_list.splice( _lru_list.begin(), _lru_list, itr->second.second );
+
+  return &itr->second.first;
+}
+
+read_cache::account_entry& read_cache::insert_account( const std::string& account )
+{
+  if( auto* entry = find_account( account ); entry != nullptr )
+    return *entry;
+
+  // If the cache is full, evict the least recently used account
+  if( _lru_list.size() >= _max_accounts )
+  {
+    _account_map.erase( _lru_list.back() );
+    _lru_list.pop_back();
+  }
+
+  _lru_list.push_front( account );
+  return _account_map.emplace( account, std::make_pair( account_entry(), _lru_list.begin() ) ).first->second.first;
+}
+
+} // namespace koinos::chain
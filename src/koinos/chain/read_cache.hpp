@@ -0,0 +1,68 @@
+#pragma once
+
+#include <koinos/chain/chain.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace koinos::chain {
+
+struct read_cache_stats
+{
+  uint64_t hits   = 0;
+  uint64_t misses = 0;
+};
+
+/**
+ * Memoizes the results of read requests against a single head block.
+ *
+ * A read cache lives as long as the head it belongs to, so it never needs invalidating. Chain wide
+ * values are kept for the lifetime of the cache while per account values are bounded by an LRU.
+ */
+class read_cache final
+{
+public:
+  static constexpr std::size_t default_max_accounts = 4'096;
+
+  read_cache( std::size_t max_accounts = default_max_accounts );
+
+  std::optional< std::string > chain_id();
+  void set_chain_id( const std::string& id );
+
+  std::optional< resource_limit_data > resource_limits();
+  void set_resource_limits( const resource_limit_data& limits );
+
+  std::optional< uint64_t > account_rc( const std::string& account );
+  void set_account_rc( const std::string& account, uint64_t rc );
+
+  std::optional< std::string > account_nonce( const std::string& account );
+  void set_account_nonce( const std::string& account, const std::string& nonce );
+
+private:
+  struct account_entry
+  {
+    std::optional< uint64_t > rc;
+    std::optional< std::string > nonce;
+  };
+
+  using lru_list_type    = std::list< std::string >;
+  using account_map_type = std::map< std::string, std::pair< account_entry, typename lru_list_type::iterator > >;
+
+  account_entry* find_account( const std::string& account );
+  account_entry& insert_account( const std::string& account );
+
+  std::mutex _mutex;
+  std::optional< std::string > _chain_id;
+  std::optional< resource_limit_data > _resource_limits;
+  lru_list_type _lru_list;
+  account_map_type _account_map;
+  const std::size_t _max_accounts;
+};
+
+} // namespace koinos::chain
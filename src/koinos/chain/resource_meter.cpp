@@ -4,6 +4,8 @@
 
 #include <boost/multiprecision/cpp_int.hpp>
 
+#include <algorithm>
+
 using int128_t = boost::multiprecision::int128_t;
 
 namespace koinos::chain {
@@ -29,6 +31,8 @@ void resource_meter::set_resource_limit_data( const resource_limit_data& rld )
 {
   _resource_limit_data           = rld;
   _disk_storage_remaining        = _resource_limit_data.disk_storage_limit();
+  _disk_storage_used             = 0;
+  _disk_storage_peak             = 0;
   _system_disk_storage_used      = 0;
   _network_bandwidth_remaining   = _resource_limit_data.network_bandwidth_limit();
   _system_network_bandwidth_used = 0;
@@ -62,6 +66,9 @@ void resource_meter::use_disk_storage( int64_t bytes )
     _disk_storage_remaining -= uint64_t( bytes );
   else
     _disk_storage_remaining += uint64_t( -1 * bytes );
+
+  _disk_storage_used += bytes;
+  _disk_storage_peak  = std::max( _disk_storage_peak, _disk_storage_used );
 }
 
 uint64_t resource_meter::disk_storage_used() const
@@ -178,6 +185,60 @@ uint64_t resource_meter::system_compute_bandwidth_used() const
   return std::max( int64_t( 0 ), _system_compute_bandwidth_used );
 }
 
+int64_t resource_meter::disk_storage_peak() const
+{
+  return _disk_storage_peak;
+}
+
+bool resource_meter::can_merge( const resource_meter& other ) const
+{
+  if( other._disk_storage_peak > 0 && uint64_t( other._disk_storage_peak ) > _disk_storage_remaining )
+    return false;
+
+  if( other.network_bandwidth_used() > _network_bandwidth_remaining )
+    return false;
+
+  // Exhausting compute bandwidth ends contract execution early, so the other meter must have stopped short of it
+  if( other.compute_bandwidth_used() >= _compute_bandwidth_remaining )
+    return false;
+
+  return true;
+}
+
+void resource_meter::merge_session_usage( const resource_meter& other )
+{
+  auto disk_storage = other._disk_storage_used - other._system_disk_storage_used;
+
+  if( disk_storage >= 0 )
+    _disk_storage_remaining -= uint64_t( disk_storage );
+  else
+    _disk_storage_remaining += uint64_t( -1 * disk_storage );
+
+  _disk_storage_used += disk_storage;
+  _disk_storage_peak  = std::max( _disk_storage_peak, _disk_storage_used );
+
+  _network_bandwidth_remaining -= other.network_bandwidth_used() - uint64_t( other._system_network_bandwidth_used );
+  _compute_bandwidth_remaining -= other.compute_bandwidth_used() - uint64_t( other._system_compute_bandwidth_used );
+}
+
+void resource_meter::merge_system_usage( const resource_meter& other )
+{
+  if( other._system_disk_storage_used >= 0 )
+    _disk_storage_remaining -= uint64_t( other._system_disk_storage_used );
+  else
+    _disk_storage_remaining += uint64_t( -1 * other._system_disk_storage_used );
+
+  _disk_storage_used        += other._system_disk_storage_used;
+  _disk_storage_peak         = std::max( _disk_storage_peak, _disk_storage_used );
+  _system_disk_storage_used += other._system_disk_storage_used;
+
+  _network_bandwidth_remaining   -= uint64_t( other._system_network_bandwidth_used );
+  _system_network_bandwidth_used += other._system_network_bandwidth_used;
+
+  _compute_bandwidth_remaining   -= uint64_t( other._system_compute_bandwidth_used );
+  _system_compute_bandwidth_used += other._system_compute_bandwidth_used;
+}
+
 void resource_meter::set_session( std::shared_ptr< abstract_rc_session > s )
 {
   _session = s;
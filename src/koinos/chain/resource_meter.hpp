@@ -45,8 +45,29 @@ public:
   uint64_t compute_bandwidth_remaining() const;
   uint64_t system_compute_bandwidth_used() const;
 
+  /**
+   * The most disk storage consumed at any point since the resource limits were set. Disk storage
+   * can be freed, so this may be larger than the disk storage currently used.
+   */
+  int64_t disk_storage_peak() const;
+
+  /**
+   * Returns true if the resources consumed by another meter, set with the same resource limits,
+   * would not have exceeded any of the limits of this meter.
+   */
+  bool can_merge( const resource_meter& other ) const;
+
+  /**
+   * Consumes the resources another meter charged to its session, without charging a session on
+   * this meter. Usage that was not charged to a session is merged by merge_system_usage.
+   */
+  void merge_session_usage( const resource_meter& other );
+  void merge_system_usage( const resource_meter& other );
+
 private:
   uint64_t _disk_storage_remaining       = 0;
+  int64_t _disk_storage_used             = 0;
+  int64_t _disk_storage_peak             = 0;
   int64_t _system_disk_storage_used      = 0;
   uint64_t _network_bandwidth_remaining  = 0;
   int64_t _system_network_bandwidth_used = 0;
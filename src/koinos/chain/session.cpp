@@ -1,6 +1,8 @@
 #include <koinos/chain/exceptions.hpp>
 #include <koinos/chain/session.hpp>
 
+#include <utility>
+
 namespace koinos::chain {
 
 session::session( int64_t begin_rc ):
@@ -34,9 +36,9 @@ void session::push_event( const protocol::event_data& ev )
   _events.push_back( ev );
 }
 
-void session::push_log( const std::string& log )
+void session::push_log( std::string log )
 {
-  _logs.push_back( log );
+  _logs.push_back( std::move( log ) );
 }
 
 const std::vector< protocol::event_data >& session::events()
@@ -49,4 +51,14 @@ const std::vector< std::string >& session::logs()
   return _logs;
 }
 
+std::vector< protocol::event_data > session::take_events()
+{
+  return std::exchange( _events, {} );
+}
+
+std::vector< std::string > session::take_logs()
+{
+  return std::exchange( _logs, {} );
+}
+
 } // namespace koinos::chain
@@ -21,9 +21,13 @@ public:
   virtual void push_event( const protocol::event_data& ev ) override;
   virtual const std::vector< protocol::event_data >& events() override;
 
-  virtual void push_log( const std::string& log ) override;
+  virtual void push_log( std::string log ) override;
   virtual const std::vector< std::string >& logs() override;
 
+  // Moves the events and logs out of the session, once they are no longer needed by it
+  std::vector< protocol::event_data > take_events();
+  std::vector< std::string > take_logs();
+
 private:
   int64_t _begin_rc;
   int64_t _end_rc;
@@ -0,0 +1,73 @@
+#include <koinos/chain/snapshot_pins.hpp>
+
+namespace koinos::chain {
+
+namespace {
+
+// A thread holding a pin must never wait on a writer that is waiting for that pin
+thread_local uint64_t pins_held = 0;
+
+} // namespace
+
+snapshot_pins::pin_ptr snapshot_pins::pin()
+{
+  {
+    std::unique_lock< std::mutex > lock( _mutex );
+
+    if( !pins_held )
+      _cv.wait( lock,
+                [ & ]()
+                {
+                  return !_draining;
+                } );
+
+    _pins++;
+  }
+
+  pins_held++;
+
+  return pin_ptr( nullptr,
+                  [ this ]( void* )
+                  {
+                    unpin();
+                  } );
+}
+
+void snapshot_pins::unpin()
+{
+  pins_held--;
+
+  std::lock_guard< std::mutex > lock( _mutex );
+
+  if( --_pins == 0 )
+    _cv.notify_all();
+}
+
+std::unique_lock< std::mutex > snapshot_pins::exclude( bool wait )
+{
+  std::unique_lock< std::mutex > lock( _mutex );
+
+  if( _pins && !wait )
+    return {};
+
+  _draining = true;
+  _cv.wait( lock,
+            [ & ]()
+            {
+              return _pins == 0;
+            } );
+  _draining = false;
+
+  // Readers that arrived while draining proceed once the lock is released
+  _cv.notify_all();
+
+  return lock;
+}
+
+uint64_t snapshot_pins::pinned() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _pins;
+}
+
+} // namespace koinos::chain
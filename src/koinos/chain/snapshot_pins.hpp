@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace koinos::chain {
+
+/**
+ * Keeps the state nodes of published head snapshots valid for readers that do not hold the database lock.
+ *
+ * Committing or discarding a node restructures the deltas that every other node reads through, so neither may
+ * happen while a reader is pinned. Writers exclude readers only for the duration of a commit or discard. A writer
+ * that does not need to wait skips committing while readers are pinned and commits on a later block instead.
+ */
+class snapshot_pins final
+{
+public:
+  using pin_ptr = std::shared_ptr< void >;
+
+  /**
+   * Pins snapshots until the returned pointer and all of its copies are released by the calling thread.
+   *
+   * Blocks while a writer waits for pinned readers to finish, unless the calling thread already holds a pin.
+   */
+  pin_ptr pin();
+
+  /**
+   * Excludes readers until the returned lock is released.
+   *
+   * If readers are pinned and wait is false, returns a lock that is not owned. Otherwise new readers are held
+   * back until those pinned have finished.
+   */
+  std::unique_lock< std::mutex > exclude( bool wait );
+
+  uint64_t pinned() const;
+
+private:
+  void unpin();
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  uint64_t _pins = 0;
+  bool _draining = false;
+};
+
+} // namespace koinos::chain
@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <cassert>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include <boost/locale/utf.hpp>
 
@@ -12,6 +14,7 @@
 #include <koinos/chain/events.pb.h>
 #include <koinos/chain/execution_context.hpp>
 #include <koinos/chain/host_api.hpp>
+#include <koinos/chain/parallel_executor.hpp>
 #include <koinos/chain/proto_utils.hpp>
 #include <koinos/chain/session.hpp>
 #include <koinos/chain/state.hpp>
@@ -89,25 +92,6 @@ void validate_hash_code( crypto::multicodec id )
   }
 }
 
-std::pair< std::string, std::string > hash_compute_keys( crypto::multicodec id )
-{
-  switch( id )
-  {
-    case crypto::multicodec::sha1:
-      return { "sha1_base", "sha1_per_byte" };
-    case crypto::multicodec::sha2_256:
-      return { "sha2_256_base", "sha2_256_per_byte" };
-    case crypto::multicodec::sha2_512:
-      return { "sha2_512_base", "sha2_512_per_byte" };
-    case crypto::multicodec::keccak_256:
-      return { "keccak_256_base", "keccak_256_per_byte" };
-    case crypto::multicodec::ripemd_160:
-      return { "ripemd_160_base", "ripemd_160_per_byte" };
-    default:
-      KOINOS_THROW( unknown_hash_code_exception, "unknown hash code" );
-  }
-}
-
 void generate_receipt( execution_context& context,
                        protocol::block_receipt& receipt,
                        const protocol::block& block,
@@ -115,6 +99,11 @@ void generate_receipt( execution_context& context,
                        uint64_t network_bandwidth_charged,
                        uint64_t compute_bandwidth_charged )
 {
+  // Events, logs and delta entries are moved into the receipt, so it can only be generated once
+  KOINOS_ASSERT( receipt.events_size() == 0 && receipt.logs_size() == 0 && receipt.state_delta_entries_size() == 0,
+                 internal_error_exception,
+                 "block receipt has already been generated" );
+
   receipt.set_id( block.id() );
   receipt.set_height( block.header().height() );
   receipt.set_disk_storage_used( context.resource_meter().disk_storage_used() );
@@ -131,8 +120,8 @@ void generate_receipt( execution_context& context,
   for( const auto& message: context.chronicler().logs() )
     *receipt.add_logs() = message;
 
-  for( const auto& entry: context.get_state_node()->get_delta_entries() )
-    *receipt.add_state_delta_entries() = entry;
+  for( auto& entry: context.get_state_node()->get_delta_entries() )
+    *receipt.add_state_delta_entries() = std::move( entry );
 }
 
 void generate_receipt( execution_context& context,
@@ -143,9 +132,14 @@ void generate_receipt( execution_context& context,
                        uint64_t disk_storage_used,
                        uint64_t network_bandwidth_used,
                        uint64_t compute_bandwidth_used,
-                       const std::vector< protocol::event_data >& events,
-                       const std::vector< std::string >& logs )
+                       std::vector< protocol::event_data >& events,
+                       std::vector< std::string >& logs )
 {
+  // Events, logs and delta entries are moved into the receipt, so it can only be generated once
+  KOINOS_ASSERT( receipt.events_size() == 0 && receipt.logs_size() == 0 && receipt.state_delta_entries_size() == 0,
+                 internal_error_exception,
+                 "transaction receipt has already been generated" );
+
   receipt.set_id( transaction.id() );
   receipt.set_payer( transaction.header().payer() );
   receipt.set_max_payer_rc( payer_rc );
@@ -155,14 +149,18 @@ void generate_receipt( execution_context& context,
   receipt.set_network_bandwidth_used( network_bandwidth_used );
   receipt.set_compute_bandwidth_used( compute_bandwidth_used );
 
-  for( const auto& e: events )
-    *receipt.add_events() = e;
+  receipt.mutable_events()->Reserve( receipt.events_size() + int( events.size() ) );
+  for( auto& e: events )
+    *receipt.add_events() = std::move( e );
+  events.clear();
 
-  for( const auto& message: logs )
-    *receipt.add_logs() = message;
+  receipt.mutable_logs()->Reserve( receipt.logs_size() + int( logs.size() ) );
+  for( auto& message: logs )
+    *receipt.add_logs() = std::move( message );
+  logs.clear();
 
-  for( const auto& entry: context.get_state_node()->get_delta_entries() )
-    *receipt.add_state_delta_entries() = entry;
+  for( auto& entry: context.get_state_node()->get_delta_entries() )
+    *receipt.add_state_delta_entries() = std::move( entry );
 }
 
 uint64_t hashes_per_leaves( uint64_t leaves )
@@ -177,6 +175,127 @@ uint64_t hashes_per_leaves( uint64_t leaves )
   return even_leaves / 2 + hashes_per_leaves( even_leaves / 2 );
 }
 
+const state_db::object_value*
+read_object( execution_context& context, const object_space& space, const std::string& key )
+{
+  state::assert_permissions( context, space );
+
+  abstract_state_node_ptr state = context.get_state_node();
+
+  KOINOS_ASSERT( state, internal_error_exception, "current state node does not exist" );
+
+  const auto result = state->get_object( space, key );
+
+  if( auto* access_log = context.state_access_log(); access_log != nullptr )
+    access_log->record_object( space, key );
+
+  if( result )
+    context.resource_meter().use_compute_bandwidth(
+      context.get_compute_bandwidth( compute_cost::object_serialization_per_byte ) * result->size() );
+
+  return result;
+}
+
+// Whether get_object is implemented by its own thunk rather than an override
+bool get_object_is_native( execution_context& context )
+{
+  auto sid = static_cast< uint32_t >( system_call_id::get_object );
+  return !context.system_call_exists( sid ) && context.thunk_translation( sid ) == sid;
+}
+
+// Equivalent to system_call::get_object( ... ).exists() when get_object is native, without copying the object
+bool object_exists( execution_context& context, const object_space& space, const std::string& key )
+{
+  auto sid    = static_cast< uint32_t >( system_call_id::get_object );
+  bool exists = false;
+
+  with_stack_frame( context,
+                    stack_frame{ .sid = sid, .call_privilege = privilege::kernel_mode },
+                    [ & ]()
+                    {
+                      context.resource_meter().use_compute_bandwidth( context.get_thunk_compute_bandwidth( sid ) );
+                      exists = read_object( context, space, key ) != nullptr;
+                    } );
+
+  return exists;
+}
+
+bool is_metadata_space( const object_space& space )
+{
+  static const auto metadata = state::space::metadata();
+  return space.system() == metadata.system() && space.zone() == metadata.zone() && space.id() == metadata.id();
+}
+
+/**
+ * Equivalent to parsing system_call::get_object( context, state::space::metadata(), key ), reusing the object
+ * parsed earlier in the block when get_object is native. A cached object is charged and logged exactly as if it
+ * had been read from state.
+ */
+template< typename T >
+std::optional< T > get_metadata_object( execution_context& context,
+                                        const std::string& key,
+                                        std::optional< cached_metadata_object< T > > metadata_cache::*entry )
+{
+  auto parse = []( const std::string& serialized ) -> T
+  {
+    if constexpr( std::is_same_v< T, std::string > )
+      return serialized;
+    else
+      return util::converter::to< T >( serialized );
+  };
+
+  if( !get_object_is_native( context ) )
+  {
+    auto obj = system_call::get_object( context, state::space::metadata(), key );
+    if( !obj.exists() )
+      return {};
+
+    return parse( obj.value() );
+  }
+
+  const auto space = state::space::metadata();
+  auto sid         = static_cast< uint32_t >( system_call_id::get_object );
+  auto& cached     = context.cached_metadata().*entry;
+  std::optional< T > value;
+
+  if( cached && !context.state_node_is_visible( cached->node ) )
+    cached.reset();
+
+  with_stack_frame(
+    context,
+    stack_frame{ .sid = sid, .call_privilege = privilege::kernel_mode },
+    [ & ]()
+    {
+      context.resource_meter().use_compute_bandwidth( context.get_thunk_compute_bandwidth( sid ) );
+
+      if( !cached )
+      {
+        if( const auto* object = read_object( context, space, key ); object != nullptr )
+        {
+          cached = cached_metadata_object< T >{ .value = parse( *object ),
+                                                .size  = object->size(),
+                                                .node  = context.get_state_node() };
+          value  = cached->value;
+        }
+
+        return;
+      }
+
+      state::assert_permissions( context, space );
+      KOINOS_ASSERT( context.get_state_node(), internal_error_exception, "current state node does not exist" );
+
+      if( auto* access_log = context.state_access_log(); access_log != nullptr )
+        access_log->record_object( space, key );
+
+      context.resource_meter().use_compute_bandwidth(
+        context.get_compute_bandwidth( compute_cost::object_serialization_per_byte ) * cached->size );
+
+      value = cached->value;
+    } );
+
+  return value;
+}
+
 template< typename T >
 bool validate_utf( const std::basic_string< T >& p_str )
 {
@@ -276,16 +395,19 @@ THUNK_DEFINE( void, apply_block, ( (const protocol::block&)block ) )
       hashes.emplace_back( system_call::hash( context,
                                               std::underlying_type_t< crypto::multicodec >( context.block_hash_code() ),
                                               util::converter::as< std::string >( trx.header() ) ) );
-      std::stringstream ss;
 
+      std::size_t signatures_size = 0;
       for( const auto& sig: trx.signatures() )
-      {
-        ss << sig;
-      }
+        signatures_size += sig.size();
+
+      std::string signatures;
+      signatures.reserve( signatures_size );
+      for( const auto& sig: trx.signatures() )
+        signatures.append( sig );
 
       hashes.emplace_back( system_call::hash( context,
                                               std::underlying_type_t< crypto::multicodec >( context.block_hash_code() ),
-                                              ss.str() ) );
+                                              signatures ) );
     }
 
     context.resource_meter().use_network_bandwidth( block.ByteSizeLong() - transactions_bytes_size );
@@ -312,13 +434,23 @@ THUNK_DEFINE( void, apply_block, ( (const protocol::block&)block ) )
     const auto serialized_block = util::converter::as< std::string >( block );
     context.get_state_node()->put_object( state::space::metadata(), state::key::head_block, &serialized_block );
 
+    std::optional< parallel_executor > executor;
+
+    if( auto* pool = context.get_worker_pool();
+        pool != nullptr && context.intent() == intent::block_application && block.transactions_size() > 1 )
+    {
+      executor.emplace( context, block, *pool );
+      executor->execute();
+    }
+
     for( uint32_t i = 0; i < block.transactions_size(); i++ )
     {
       const auto& tx = block.transactions( i );
 
       try
       {
-        system_call::apply_transaction( context, tx );
+        if( !executor || !executor->commit( i ) )
+          system_call::apply_transaction( context, tx );
       }
       catch( const reversion_exception& )
       {} /* do nothing */
@@ -392,6 +524,7 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
   uint64_t payer_rc               = 0;
   std::vector< protocol::event_data > events;
   std::vector< std::string > logs;
+  bool receipt_generated = false;
 
   try
   {
@@ -428,9 +561,9 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
                      failure_exception,
                      "payer does not have the rc to cover transaction rc limit" );
 
-      auto chain_id = system_call::get_object( context, state::space::metadata(), state::key::chain_id );
-      KOINOS_ASSERT( chain_id.exists(), failure_exception, "chain id does not exist" );
-      KOINOS_ASSERT( trx.header().chain_id() == chain_id.value(), failure_exception, "chain id mismatch" );
+      auto chain_id = get_metadata_object( context, state::key::chain_id, &metadata_cache::chain_id );
+      KOINOS_ASSERT( chain_id, failure_exception, "chain id does not exist" );
+      KOINOS_ASSERT( trx.header().chain_id() == *chain_id, failure_exception, "chain id mismatch" );
 
       KOINOS_ASSERT( system_call::hash( context,
                                         std::underlying_type_t< crypto::multicodec >( context.block_hash_code() ),
@@ -510,9 +643,10 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
     // The anonymous node must be created after requiring authority and the pre transaction callback
     // because those calls might write to database and those writes must persist regardless of whether
     // the rest of the transaction is reverted or not.
-    auto block_node = context.get_state_node();
-    auto trx_node   = block_node->create_anonymous_node();
-    context.set_state_node( trx_node, block_node->parent() );
+    auto block_node  = context.get_state_node();
+    auto parent_node = context.get_parent_node();
+    auto trx_node    = block_node->create_anonymous_node();
+    context.set_state_node( trx_node, parent_node );
 
     try
     {
@@ -543,7 +677,7 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
       if( context.intent() != intent::block_proposal )
         throw;
 
-      context.set_state_node( block_node );
+      context.set_state_node( block_node, parent_node );
       return;
     }
     catch( const reversion_exception& e )
@@ -569,12 +703,12 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
     // BEGIN: No throw section
     // Throwing will result in lost events and logs on transaction receipts.
 
-    context.set_state_node( block_node );
+    context.set_state_node( block_node, parent_node );
 
     used_rc = payer_session->used_rc();
-    logs    = payer_session->logs();
+    logs    = payer_session->take_logs();
     if( !receipt.reverted() )
-      events = payer_session->events();
+      events = payer_session->take_events();
 
     disk_storage_used      = context.resource_meter().disk_storage_used() - start_disk_used;
     network_bandwidth_used = context.resource_meter().network_bandwidth_used() - start_network_used;
@@ -589,6 +723,7 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
                    "unable to consume rc for payer: ${p}",
                    ( "p", util::to_base58( payer ) ); );
 
+    receipt_generated = true;
     generate_receipt( context,
                       receipt,
                       trx,
@@ -608,10 +743,10 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
         KOINOS_ASSERT( std::holds_alternative< protocol::block_receipt >( context.receipt() ),
                        failure_exception,
                        "expected block receipt with block application intent" );
-        *std::get< protocol::block_receipt >( context.receipt() ).add_transaction_receipts() = receipt;
+        *std::get< protocol::block_receipt >( context.receipt() ).add_transaction_receipts() = std::move( receipt );
         break;
       case intent::transaction_application:
-        context.receipt() = receipt;
+        context.receipt() = std::move( receipt );
         break;
       default:
         assert( false );
@@ -620,16 +755,19 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
   }
   catch( const koinos::exception& e )
   {
-    generate_receipt( context,
-                      receipt,
-                      trx,
-                      payer_rc,
-                      used_rc,
-                      disk_storage_used,
-                      network_bandwidth_used,
-                      compute_bandwidth_used,
-                      events,
-                      logs );
+    if( !receipt_generated )
+    {
+      generate_receipt( context,
+                        receipt,
+                        trx,
+                        payer_rc,
+                        used_rc,
+                        disk_storage_used,
+                        network_bandwidth_used,
+                        compute_bandwidth_used,
+                        events,
+                        logs );
+    }
 
     switch( context.intent() )
     {
@@ -639,10 +777,10 @@ THUNK_DEFINE( void, apply_transaction, ( (const protocol::transaction&)trx ) )
         KOINOS_ASSERT( std::holds_alternative< protocol::block_receipt >( context.receipt() ),
                        failure_exception,
                        "expected block receipt with block application intent" );
-        *std::get< protocol::block_receipt >( context.receipt() ).add_transaction_receipts() = receipt;
+        *std::get< protocol::block_receipt >( context.receipt() ).add_transaction_receipts() = std::move( receipt );
         break;
       case intent::transaction_application:
-        context.receipt() = receipt;
+        context.receipt() = std::move( receipt );
         break;
       default:
         assert( false );
@@ -815,7 +953,8 @@ THUNK_DEFINE_VOID( void, post_transaction_callback ) {}
 THUNK_DEFINE_VOID( get_chain_id_result, get_chain_id )
 {
   get_chain_id_result ret;
-  ret.set_value( system_call::get_object( context, state::space::metadata(), state::key::chain_id ).value() );
+  ret.set_value(
+    get_metadata_object( context, state::key::chain_id, &metadata_cache::chain_id ).value_or( std::string() ) );
   return ret;
 }
 
@@ -827,7 +966,8 @@ THUNK_DEFINE( process_block_signature_result,
               process_block_signature,
               ( (const std::string&)id, (const protocol::block_header&)header, (const std::string&)signature_data ) )
 {
-  auto genesis_addr = system_call::get_object( context, state::space::metadata(), state::key::genesis_key ).value();
+  auto genesis_addr =
+    get_metadata_object( context, state::key::genesis_key, &metadata_cache::genesis_key ).value_or( std::string() );
 
   process_block_signature_result ret;
   ret.set_value( genesis_addr
@@ -960,7 +1100,8 @@ THUNK_DEFINE_VOID( check_system_authority_result, check_system_authority )
 {
   check_system_authority_result res;
 
-  auto genesis_addr = system_call::get_object( context, state::space::metadata(), state::key::genesis_key ).value();
+  auto genesis_addr =
+    get_metadata_object( context, state::key::genesis_key, &metadata_cache::genesis_key ).value_or( std::string() );
 
   const auto* trx = context.get_transaction();
   KOINOS_ASSERT( trx != nullptr, internal_error_exception, "transaction does not exist" );
@@ -999,11 +1140,12 @@ THUNK_DEFINE_VOID( get_operation_result, get_operation )
 
 THUNK_DEFINE( get_account_rc_result, get_account_rc, ( (const std::string&)account ) )
 {
-  auto obj = system_call::get_object( context, state::space::metadata(), state::key::max_account_resources );
-  KOINOS_ASSERT( obj.exists(), internal_error_exception, "max_account_resources does not exist" );
+  auto obj =
+    get_metadata_object( context, state::key::max_account_resources, &metadata_cache::max_account_resources );
+  KOINOS_ASSERT( obj, internal_error_exception, "max_account_resources does not exist" );
 
   get_account_rc_result ret;
-  ret.set_value( util::converter::to< chain::max_account_resources >( obj.value() ).value() );
+  ret.set_value( obj->value() );
 
   return ret;
 }
@@ -1019,11 +1161,11 @@ THUNK_DEFINE_VOID( get_resource_limits_result, get_resource_limits )
 {
   resource_limit_data rd;
 
-  auto obj = system_call::get_object( context, state::space::metadata(), state::key::resource_limit_data );
-  KOINOS_ASSERT( obj.exists(), internal_error_exception, "resource_limit_data does not exist" );
+  auto obj = get_metadata_object( context, state::key::resource_limit_data, &metadata_cache::resource_limits );
+  KOINOS_ASSERT( obj, internal_error_exception, "resource_limit_data does not exist" );
 
   get_resource_limits_result ret;
-  *ret.mutable_value() = util::converter::to< resource_limit_data >( obj.value() );
+  *ret.mutable_value() = std::move( *obj );
   return ret;
 }
 
@@ -1043,8 +1185,8 @@ THUNK_DEFINE( consume_block_resources_result,
 THUNK_DEFINE( void, put_object, ( (const object_space&)space, (const std::string&)key, (const std::string&)obj ) )
 {
   KOINOS_ASSERT( !context.read_only(), read_only_context_exception, "cannot put object during read only call" );
-  context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( "object_serialization_per_byte" )
-                                                  * obj.size() );
+  context.resource_meter().use_compute_bandwidth(
+    context.get_compute_bandwidth( compute_cost::object_serialization_per_byte ) * obj.size() );
 
   state::assert_permissions( context, space );
 
@@ -1052,6 +1194,12 @@ THUNK_DEFINE( void, put_object, ( (const object_space&)space, (const std::string
   KOINOS_ASSERT( state, internal_error_exception, "current state node does not exist" );
   auto val = util::converter::as< state_db::object_value >( obj );
 
+  if( auto* access_log = context.state_access_log(); access_log != nullptr )
+    access_log->record_object( space, key );
+
+  if( is_metadata_space( space ) )
+    context.invalidate_metadata_cache();
+
   context.resource_meter().use_disk_storage( state->put_object( space, key, &val ) );
 }
 
@@ -1064,25 +1212,23 @@ THUNK_DEFINE( void, remove_object, ( (const object_space&)space, (const std::str
   auto state = context.get_state_node();
   KOINOS_ASSERT( state, internal_error_exception, "current state node does not exist" );
 
+  if( auto* access_log = context.state_access_log(); access_log != nullptr )
+    access_log->record_object( space, key );
+
+  if( is_metadata_space( space ) )
+    context.invalidate_metadata_cache();
+
   context.resource_meter().use_disk_storage( state->remove_object( space, key ) );
 }
 
 THUNK_DEFINE( get_object_result, get_object, ( (const object_space&)space, (const std::string&)key ) )
 {
-  state::assert_permissions( context, space );
-
-  abstract_state_node_ptr state = context.get_state_node();
-
-  KOINOS_ASSERT( state, internal_error_exception, "current state node does not exist" );
-
-  const auto result = state->get_object( space, key );
+  const auto result = read_object( context, space, key );
 
   get_object_result ret;
 
   if( result )
   {
-    context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( "object_serialization_per_byte" )
-                                                    * result->size() );
     ret.mutable_value()->set_exists( true );
     ret.mutable_value()->set_value( result->data(), result->size() );
   }
@@ -1099,12 +1245,15 @@ THUNK_DEFINE( get_next_object_result, get_next_object, ( (const object_space&)sp
 
   const auto [ result, next_key ] = state->get_next_object( space, key );
 
+  if( auto* access_log = context.state_access_log(); access_log != nullptr )
+    access_log->record_next_object( space, key, result, next_key );
+
   get_next_object_result ret;
 
   if( result )
   {
-    context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( "object_serialization_per_byte" )
-                                                    * result->size() );
+    context.resource_meter().use_compute_bandwidth(
+      context.get_compute_bandwidth( compute_cost::object_serialization_per_byte ) * result->size() );
     ret.mutable_value()->set_exists( true );
     ret.mutable_value()->set_value( result->data(), result->size() );
     ret.mutable_value()->set_key( next_key );
@@ -1122,12 +1271,15 @@ THUNK_DEFINE( get_prev_object_result, get_prev_object, ( (const object_space&)sp
 
   const auto [ result, next_key ] = state->get_prev_object( space, key );
 
+  if( auto* access_log = context.state_access_log(); access_log != nullptr )
+    access_log->record_prev_object( space, key, result, next_key );
+
   get_prev_object_result ret;
 
   if( result )
   {
-    context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( "object_serialization_per_byte" )
-                                                    * result->size() );
+    context.resource_meter().use_compute_bandwidth(
+      context.get_compute_bandwidth( compute_cost::object_serialization_per_byte ) * result->size() );
     ret.mutable_value()->set_exists( true );
     ret.mutable_value()->set_value( result->data(), result->size() );
     ret.mutable_value()->set_key( next_key );
@@ -1154,7 +1306,7 @@ THUNK_DEFINE( void,
   KOINOS_ASSERT( name.size() <= 128, reversion_exception, "event name cannot be larger than 128 bytes" );
   KOINOS_ASSERT( validate_utf( name ), reversion_exception, "event name contains invalid utf-8" );
 
-  context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( "event_per_impacted" )
+  context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( compute_cost::event_per_impacted )
                                                   * impacted.size() );
 
   const auto& caller = context.get_caller();
@@ -1183,13 +1335,23 @@ THUNK_DEFINE( hash_result, hash, ( (uint64_t)id, (const std::string&)obj, (uint6
   auto multicodec = static_cast< crypto::multicodec >( id );
   validate_hash_code( multicodec );
 
-  auto [ hash_base, hash_per_byte ] = hash_compute_keys( multicodec );
+  auto [ hash_base, hash_per_byte ] = compute_registry::hash_costs( multicodec );
   context.resource_meter().use_compute_bandwidth( context.get_compute_bandwidth( hash_base )
                                                   + context.get_compute_bandwidth( hash_per_byte ) * obj.size() );
 
+  hash_result ret;
+
+  if( const auto& memo = context.verification_memo(); memo )
+  {
+    if( const auto* digest = memo->find_hash( id, obj, size ); digest != nullptr )
+    {
+      ret.set_value( *digest );
+      return ret;
+    }
+  }
+
   auto hash = crypto::hash( multicodec, obj, crypto::digest_size( size ) );
 
-  hash_result ret;
   ret.set_value( util::converter::as< std::string >( hash ) );
   return ret;
 }
@@ -1207,10 +1369,20 @@ THUNK_DEFINE( recover_public_key_result,
                  invalid_signature_exception,
                  "signature must be canonical" );
 
+  recover_public_key_result ret;
+
+  if( const auto& memo = context.verification_memo(); compressed && memo )
+  {
+    if( const auto* public_key = memo->find_public_key( signature_data, digest ); public_key != nullptr )
+    {
+      ret.set_value( *public_key );
+      return ret;
+    }
+  }
+
   auto pub_key = crypto::public_key::recover( signature, util::converter::to< crypto::multihash >( digest ) );
   KOINOS_ASSERT( pub_key.valid(), invalid_signature_exception, "public key is invalid" );
 
-  recover_public_key_result ret;
   if( compressed )
     ret.set_value( util::converter::as< std::string >( pub_key ) );
   else
@@ -1223,8 +1395,9 @@ THUNK_DEFINE( verify_merkle_root_result,
               verify_merkle_root,
               ( (const std::string&)root, (const std::vector< std::string >&)hashes ) )
 {
-  uint64_t deserialize_multihash_base     = context.get_compute_bandwidth( "deserialize_multihash_base" );
-  uint64_t deserialize_multihash_per_byte = context.get_compute_bandwidth( "deserialize_multihash_per_byte" );
+  const auto& registry                    = context.get_compute_registry();
+  uint64_t deserialize_multihash_base     = registry.compute( compute_cost::deserialize_multihash_base );
+  uint64_t deserialize_multihash_per_byte = registry.compute( compute_cost::deserialize_multihash_per_byte );
 
   // Charge for all deserialization
   context.resource_meter().use_compute_bandwidth(
@@ -1232,39 +1405,44 @@ THUNK_DEFINE( verify_merkle_root_result,
 
   auto root_hash = util::converter::to< crypto::multihash >( root );
 
-  auto [ hash_base_key, hash_per_byte_key ] = hash_compute_keys( root_hash.code() );
-  uint64_t hash_base                        = context.get_compute_bandwidth( hash_base_key );
-  uint64_t hash_per_byte                    = context.get_compute_bandwidth( hash_per_byte_key );
+  auto [ hash_base_key, hash_per_byte_key ] = compute_registry::hash_costs( root_hash.code() );
+  uint64_t hash_base                        = registry.compute( hash_base_key );
+  uint64_t hash_per_byte                    = registry.compute( hash_per_byte_key );
   // Charge for all hashing to compute merkle root
   context.resource_meter().use_compute_bandwidth( hashes_per_leaves( hashes.size() )
                                                   * ( hash_base + 2 * root_hash.digest().size() * hash_per_byte ) );
 
   validate_hash_code( root_hash.code() );
 
+  verify_merkle_root_result ret;
+
+  if( const auto& memo = context.verification_memo(); memo )
+  {
+    if( auto matches = memo->find_merkle_root( root, hashes ); matches )
+    {
+      ret.set_value( *matches );
+      return ret;
+    }
+  }
+
   std::vector< crypto::multihash > leaves;
+  leaves.reserve( hashes.size() );
 
-  leaves.resize( hashes.size() );
-  std::transform( std::begin( hashes ),
-                  std::end( hashes ),
-                  std::begin( leaves ),
-                  [ & ]( const std::string& s )
-                  {
-                    auto mh = util::converter::to< crypto::multihash >( s );
-                    KOINOS_ASSERT( mh.code() == root_hash.code(),
-                                   unknown_hash_code_exception,
-                                   "leaf and merkle root hash codes do not match" );
-                    KOINOS_ASSERT( mh.digest().size() == root_hash.digest().size(),
-                                   unknown_hash_code_exception,
-                                   "leaf and merkle root hash sizes do not match" );
-                    return mh;
-                  } );
+  for( const auto& s: hashes )
+  {
+    auto mh = util::converter::to< crypto::multihash >( s );
+    KOINOS_ASSERT( mh.code() == root_hash.code(),
+                   unknown_hash_code_exception,
+                   "leaf and merkle root hash codes do not match" );
+    KOINOS_ASSERT( mh.digest().size() == root_hash.digest().size(),
+                   unknown_hash_code_exception,
+                   "leaf and merkle root hash sizes do not match" );
+    leaves.emplace_back( std::move( mh ) );
+  }
 
   auto mtree = crypto::merkle_tree( root_hash.code(), leaves );
 
-  auto merkle_root = mtree.root()->hash();
-
-  verify_merkle_root_result ret;
-  ret.set_value( merkle_root == root_hash );
+  ret.set_value( mtree.root()->hash() == root_hash );
   return ret;
 }
 
@@ -1317,13 +1495,28 @@ THUNK_DEFINE( verify_vrf_proof_result,
 
 THUNK_DEFINE( call_result, call, ( (const std::string&)contract_id, (uint32_t)entry_point, (const std::string&)args ) )
 {
-  // We need to be in kernel mode to read the contract data
-  auto contract_object = system_call::get_object( context, state::space::contract_bytecode(), contract_id );
-  KOINOS_ASSERT( contract_object.exists(), invalid_contract_exception, "contract does not exist" );
+  // We need to be in kernel mode to read the contract data. When get_object is native, the bytecode is charged
+  // for as usual but only read from state when the backend has not already cached its module.
+  bool in_place = get_object_is_native( context );
+  std::string bytecode;
+
+  if( in_place )
+  {
+    KOINOS_ASSERT( object_exists( context, state::space::contract_bytecode(), contract_id ),
+                   invalid_contract_exception,
+                   "contract does not exist" );
+  }
+  else
+  {
+    auto contract_object = system_call::get_object( context, state::space::contract_bytecode(), contract_id );
+    KOINOS_ASSERT( contract_object.exists(), invalid_contract_exception, "contract does not exist" );
+    bytecode = std::move( *contract_object.mutable_value() );
+  }
+
   auto contract_meta_object = system_call::get_object( context, state::space::contract_metadata(), contract_id );
   KOINOS_ASSERT( contract_meta_object.exists(), invalid_contract_exception, "contract metadata does not exist" );
-  auto contract_meta = util::converter::to< contract_metadata_object >( contract_meta_object.value() );
-  KOINOS_ASSERT( contract_meta.hash().size(), invalid_contract_exception, "contract hash does not exist" );
+  auto contract_meta = context.contract_metadata( contract_id, contract_meta_object.value() );
+  KOINOS_ASSERT( contract_meta->hash().size(), invalid_contract_exception, "contract hash does not exist" );
 
   // authorize should only be called from kernel mode
   KOINOS_ASSERT( entry_point != authorize_entrypoint || context.get_caller_privilege() == privilege::kernel_mode,
@@ -1335,13 +1528,28 @@ THUNK_DEFINE( call_result, call, ( (const std::string&)contract_id, (uint32_t)en
     with_stack_frame(
       context,
       stack_frame{ .contract_id    = contract_id,
-                   .call_privilege = contract_meta.system() ? privilege::kernel_mode : privilege::user_mode,
+                   .call_privilege = contract_meta->system() ? privilege::kernel_mode : privilege::user_mode,
                    .call_args      = args,
                    .entry_point    = entry_point },
       [ & ]
       {
         chain::host_api hapi( context );
-        context.get_backend()->run( hapi, contract_object.value(), contract_meta.hash() );
+
+        if( !in_place )
+        {
+          context.get_backend()->run( hapi, bytecode, contract_meta->hash() );
+          return;
+        }
+
+        // The existence of the bytecode, and its cost, have been accounted for above
+        auto load_bytecode = [ & ]() -> const std::string&
+        {
+          const auto* object = context.get_state_node()->get_object( state::space::contract_bytecode(), contract_id );
+          KOINOS_ASSERT( object, invalid_contract_exception, "contract does not exist" );
+          return *object;
+        };
+
+        context.get_backend()->run_cached( hapi, contract_meta->hash(), load_bytecode );
       } );
   }
   catch( const success_exception& )
@@ -1370,28 +1578,14 @@ THUNK_DEFINE( void, exit, ( (int32_t)code, (result)res ) )
 {
   context.set_result( { code, res } );
 
+  // The result is returned by value, errors are raised once the contract has stopped executing
   if( !code ) // code == success
-  {
-    throw success_exception( code );
-  }
+    return;
 
   KOINOS_ASSERT( res.has_error(), reversion_exception, "exit error did not contain error data" );
-  const auto& error = context.get_result().res.error();
-
-  if( code >= reversion )
-  {
-    if( validate_utf( error.message() ) )
-      throw reversion_exception( code, error );
-    else
-      throw reversion_exception( chain::reversion, "error message contains invalid utf-8" );
-  }
-  else // code <= failure
-  {
-    if( validate_utf( error.message() ) )
-      throw failure_exception( code, error );
-    else
-      throw reversion_exception( chain::reversion, "error message contains invalid utf-8" );
-  }
+  KOINOS_ASSERT( validate_utf( context.get_result().res.error().message() ),
+                 reversion_exception,
+                 "error message contains invalid utf-8" );
 }
 
 THUNK_DEFINE_VOID( get_arguments_result, get_arguments )
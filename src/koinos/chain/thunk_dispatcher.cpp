@@ -21,19 +21,43 @@ void thunk_dispatcher::call_thunk( uint32_t id,
                                    uint32_t arg_len,
                                    uint32_t* bytes_written ) const
 {
-  auto it = _dispatch_map.find( id );
-  KOINOS_ASSERT( it != _dispatch_map.end(), unknown_thunk_exception, "thunk ${id} not found", ( "id", id ) );
-  it->second( ctx, ret_ptr, ret_len, arg_ptr, arg_len, bytes_written );
+  const auto* entry = find( id );
+  KOINOS_ASSERT( entry != nullptr, unknown_thunk_exception, "thunk ${id} not found", ( "id", id ) );
+  entry->handler( entry->thunk, ctx, ret_ptr, ret_len, arg_ptr, arg_len, bytes_written );
 }
 
 bool thunk_dispatcher::thunk_exists( uint32_t id ) const
 {
-  return _dispatch_map.count( id );
+  return find( id ) != nullptr;
 }
 
 bool thunk_dispatcher::thunk_is_genesis( uint32_t id ) const
 {
-  return _genesis_thunks.count( id );
+  const auto* entry = find( id );
+  return entry != nullptr && entry->genesis;
+}
+
+const thunk_dispatcher::thunk_entry* thunk_dispatcher::find( uint32_t id ) const
+{
+  if( id < _thunk_table.size() )
+    return _thunk_table[ id ].handler ? &_thunk_table[ id ] : nullptr;
+
+  if( id < max_table_thunk_id )
+    return nullptr;
+
+  auto itr = _thunk_map.find( id );
+  return itr != _thunk_map.end() ? &itr->second : nullptr;
+}
+
+thunk_dispatcher::thunk_entry& thunk_dispatcher::emplace( uint32_t id )
+{
+  if( id >= max_table_thunk_id )
+    return _thunk_map[ id ];
+
+  if( id >= _thunk_table.size() )
+    _thunk_table.resize( id + 1 );
+
+  return _thunk_table[ id ];
 }
 
 } // namespace koinos::chain
@@ -4,14 +4,20 @@
 #include <koinos/chain/execution_context.hpp>
 #include <koinos/chain/system_calls.hpp>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/message.h>
 
 #include <any>
+#include <array>
 #include <cstdint>
-#include <functional>
 #include <map>
+#include <string>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 namespace koinos::chain {
 
@@ -227,13 +233,19 @@ void get_type_from_field( const google::protobuf::Message& msg,
   v = std::any_cast< std::vector< T > >( get_type_from_repeated_field< T >( msg, fd ) );
 }
 
+// Overload to capture when field is a string, copying it out of the message only once
+inline void
+get_type_from_field( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd, std::string& t )
+{
+  t = msg.GetReflection()->GetStringReference( msg, fd, &t );
+}
+
 // Overload to capture when field is a Message
 template< typename T >
 std::enable_if_t< std::is_base_of_v< google::protobuf::Message, T >, void >
 get_type_from_field( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd, T& t )
 {
-  auto ptr = std::any_cast< const google::protobuf::Message* >( get_type_from_field_impl( msg, fd ) );
-  t.CopyFrom( *ptr );
+  t.CopyFrom( msg.GetReflection()->GetMessage( msg, fd ) );
 }
 
 // Overload to capture when field is an Enum
@@ -244,73 +256,221 @@ get_type_from_field( const google::protobuf::Message& msg, const google::protobu
   t = T( std::any_cast< std::underlying_type_t< T > >( get_type_from_field_impl( msg, fd ) ) );
 }
 
-// Overload to capture when field is neither
+// Overload to capture when field is neither. Integral and bool fields of the expected type are read directly,
+// anything else falls back to the checked conversion through std::any.
 template< typename T >
 std::enable_if_t< !std::is_base_of_v< google::protobuf::Message, T > && !std::is_enum_v< T >, void >
 get_type_from_field( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd, T& t )
 {
+  using cpp_type = google::protobuf::FieldDescriptor::CppType;
+  auto ref       = msg.GetReflection();
+
+  if constexpr( std::is_same_v< T, uint64_t > )
+  {
+    if( fd->cpp_type() == cpp_type::CPPTYPE_UINT64 )
+      return void( t = ref->GetUInt64( msg, fd ) );
+  }
+  else if constexpr( std::is_same_v< T, int64_t > )
+  {
+    if( fd->cpp_type() == cpp_type::CPPTYPE_INT64 )
+      return void( t = ref->GetInt64( msg, fd ) );
+  }
+  else if constexpr( std::is_same_v< T, uint32_t > )
+  {
+    if( fd->cpp_type() == cpp_type::CPPTYPE_UINT32 )
+      return void( t = ref->GetUInt32( msg, fd ) );
+  }
+  else if constexpr( std::is_same_v< T, int32_t > )
+  {
+    if( fd->cpp_type() == cpp_type::CPPTYPE_INT32 )
+      return void( t = ref->GetInt32( msg, fd ) );
+  }
+  else if constexpr( std::is_same_v< T, bool > )
+  {
+    if( fd->cpp_type() == cpp_type::CPPTYPE_BOOL )
+      return void( t = ref->GetBool( msg, fd ) );
+  }
+
   t = std::any_cast< T >( get_type_from_field_impl( msg, fd ) );
 }
 
-// Variadic recusrive template to convert fields of a message in to a tuple
-// Arg type information is assumed to match the fields of the corresponding Message
-// Each call strips off the next argument (T), parses it with get_type_from_field,
-// adds it to the tuple and recusively calls with the remaining arguments (Ts).
-// The base case is when there are no more fields remaining (Ts is empty).
-template< typename T, typename... Ts >
-std::tuple< T, Ts... > message_to_tuple_impl( const google::protobuf::Message& msg )
+// The field of each argument, looked up once per arguments message. Arguments are the last N fields, in order.
+template< typename ArgStruct, std::size_t N >
+const std::array< const google::protobuf::FieldDescriptor*, N >& argument_fields()
 {
-  // Get our type
-  constexpr std::size_t fields_remaining = sizeof...( Ts );
-  auto desc                              = msg.GetDescriptor();
-  auto fd                                = desc->FindFieldByNumber( desc->field_count() - fields_remaining );
-  T t;
-  get_type_from_field( msg, fd, t );
-
-  if constexpr( fields_remaining > 0 )
-    return std::tuple_cat( std::tuple< T >( std::move( t ) ), message_to_tuple_impl< Ts... >( msg ) );
-  else
-    return std::tuple< T >( std::move( t ) );
+  static const auto fields = []()
+  {
+    std::array< const google::protobuf::FieldDescriptor*, N > fds{};
+    auto desc = ArgStruct::descriptor();
+
+    for( std::size_t i = 0; i < N; i++ )
+      fds[ i ] = desc->FindFieldByNumber( int( desc->field_count() - N + i + 1 ) );
+
+    return fds;
+  }();
+
+  return fields;
 }
 
+// Holds a thunk argument while the thunk is called, copied out of the arguments message
+template< typename T, typename = void >
+struct argument_holder
+{
+  std::decay_t< T > value;
+
+  void set( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd )
+  {
+    get_type_from_field( msg, fd, value );
+  }
+
+  std::decay_t< T >& get()
+  {
+    return value;
+  }
+};
+
+// Strings taken by const reference are viewed in place in the arguments message
+template<>
+struct argument_holder< const std::string& >
+{
+  std::string scratch;
+  const std::string* value = nullptr;
+
+  argument_holder()                         = default;
+  argument_holder( const argument_holder& ) = delete;
+
+  void set( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd )
+  {
+    value = &msg.GetReflection()->GetStringReference( msg, fd, &scratch );
+  }
+
+  const std::string& get() const
+  {
+    return *value;
+  }
+};
+
+// Messages taken by const reference are viewed in place in the arguments message
+template< typename T >
+struct argument_holder< const T&, std::enable_if_t< std::is_base_of_v< google::protobuf::Message, T > > >
+{
+  const T* value = nullptr;
+
+  void set( const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fd )
+  {
+    const auto& field = msg.GetReflection()->GetMessage( msg, fd );
+
+    if( field.GetDescriptor() != T::descriptor() )
+      throw std::bad_any_cast();
+
+    value = static_cast< const T* >( &field );
+  }
+
+  const T& get() const
+  {
+    return *value;
+  }
+};
+
 template< typename... Ts >
-std::tuple< std::decay_t< Ts >... > message_to_tuple( const google::protobuf::Message& msg )
+using argument_tuple = std::tuple< argument_holder< Ts >... >;
+
+// Reads the fields of a message in to the holders of the thunk's arguments.
+// Arg type information is assumed to match the fields of the corresponding Message.
+template< typename ArgStruct, typename... Ts, std::size_t... Is >
+void message_to_arguments_impl( const ArgStruct& msg, argument_tuple< Ts... >& t, std::index_sequence< Is... > )
 {
-  return message_to_tuple_impl< std::decay_t< Ts >... >( msg );
+  [[maybe_unused]] const auto& fields = argument_fields< ArgStruct, sizeof...( Ts ) >();
+  ( std::get< Is >( t ).set( msg, fields[ Is ] ), ... );
 }
 
-template<>
-inline std::tuple<> message_to_tuple<>( const google::protobuf::Message& )
+template< typename ArgStruct, typename... Ts >
+void message_to_arguments( const ArgStruct& msg, argument_tuple< Ts... >& t )
 {
-  return std::tuple<>();
+  message_to_arguments_impl< ArgStruct, Ts... >( msg, t, std::index_sequence_for< Ts... >() );
 }
 
+/**
+ * Arguments are parsed in to messages that are reused from call to call, allocated on a per thread arena.
+ *
+ * A thunk can be reentered through a nested contract call while its arguments are still in use, so a message is
+ * kept for each depth the arguments type has been entered at.
+ */
+template< typename ArgStruct >
+class argument_message
+{
+public:
+  argument_message()
+  {
+    auto& s = get_slots();
+
+    if( s.depth == s.messages.size() )
+      s.messages.push_back( google::protobuf::Arena::CreateMessage< ArgStruct >( &s.arena ) );
+
+    _message = s.messages[ s.depth++ ];
+    _message->Clear();
+  }
+
+  argument_message( const argument_message& ) = delete;
+
+  ~argument_message()
+  {
+    get_slots().depth--;
+  }
+
+  ArgStruct& get()
+  {
+    return *_message;
+  }
+
+private:
+  struct slots
+  {
+    google::protobuf::Arena arena;
+    std::vector< ArgStruct* > messages;
+    std::size_t depth = 0;
+  };
+
+  static slots& get_slots()
+  {
+    thread_local slots s;
+    return s;
+  }
+
+  ArgStruct* _message;
+};
+
 /*
  * std::apply takes a function and a tuple and calls the function with the contents of the tuple
  * as the arguments. The only "trick" here is converting a reflected object in to an equivalent
- * tuple. That is handled as part of the reflection macro to generate the needed code. We cat a
- * tuple containing just the apply context as the first argument and then call in to the thunk.
+ * tuple, which is handled by message_to_arguments. The apply context is passed as the first argument.
  *
  * Two versions exist of the function, one that serializes the return value and one that does not.
  */
 template< typename ArgStruct, typename RetStruct, typename ThunkReturn, typename... ThunkArgs >
 typename std::enable_if< std::is_same< ThunkReturn, void >::value, void >::type
-call_thunk_impl( const std::function< ThunkReturn( execution_context&, ThunkArgs... ) >& thunk,
+call_thunk_impl( ThunkReturn ( *thunk )( execution_context&, ThunkArgs... ),
                  execution_context& ctx,
                  char* ret_ptr,
                  uint32_t ret_len,
                  ArgStruct& arg,
                  uint32_t* bytes_written )
 {
-  auto thunk_args = std::tuple_cat( std::tuple< execution_context& >( ctx ), message_to_tuple< ThunkArgs... >( arg ) );
-  *bytes_written  = 0;
-
-  std::apply( thunk, thunk_args );
+  argument_tuple< ThunkArgs... > thunk_args;
+  message_to_arguments( arg, thunk_args );
+  *bytes_written = 0;
+
+  std::apply(
+    [ & ]( auto&... args )
+    {
+      thunk( ctx, args.get()... );
+    },
+    thunk_args );
 }
 
 template< typename ArgStruct, typename RetStruct, typename ThunkReturn, typename... ThunkArgs >
 typename std::enable_if< !std::is_same< ThunkReturn, void >::value, void >::type
-call_thunk_impl( const std::function< ThunkReturn( execution_context&, ThunkArgs... ) >& thunk,
+call_thunk_impl( ThunkReturn ( *thunk )( execution_context&, ThunkArgs... ),
                  execution_context& ctx,
                  char* ret_ptr,
                  uint32_t ret_len,
@@ -319,10 +479,15 @@ call_thunk_impl( const std::function< ThunkReturn( execution_context&, ThunkArgs
 {
   static_assert( std::is_same< RetStruct, ThunkReturn >::value,
                  "thunk return does not match defined return in koinos-proto" );
-  auto thunk_args = std::tuple_cat( std::tuple< execution_context& >( ctx ), message_to_tuple< ThunkArgs... >( arg ) );
-  ThunkReturn ret;
+  argument_tuple< ThunkArgs... > thunk_args;
+  message_to_arguments( arg, thunk_args );
 
-  ret = std::apply( thunk, thunk_args );
+  ThunkReturn ret = std::apply(
+    [ & ]( auto&... args )
+    {
+      return thunk( ctx, args.get()... );
+    },
+    thunk_args );
 
   std::size_t byte_size = ret.ByteSizeLong();
   KOINOS_ASSERT( byte_size <= ret_len,
@@ -350,10 +515,16 @@ call_thunk_impl( const std::function< ThunkReturn( execution_context&, ThunkArgs
  *
  * When upgrading a system call from one thunk to another, the new thunk **MUST**
  * have identical function signature to the existing thunk.
+ *
+ * Thunks are kept in a table indexed by thunk ID, holding plain function pointers, so that
+ * dispatching a thunk is a bounds check and an indirect call.
  */
 class thunk_dispatcher
 {
 public:
+  // IDs at or above this are kept in an ordered map instead of the table
+  static constexpr uint32_t max_table_thunk_id = 4'096;
+
   void call_thunk( uint32_t id,
                    execution_context& ctx,
                    char* ret_ptr,
@@ -365,39 +536,31 @@ public:
   template< typename ThunkReturn, typename... ThunkArgs >
   auto call_thunk( uint32_t id, execution_context& ctx, ThunkArgs&... args ) const
   {
-    auto it = _pass_through_map.find( id );
-    KOINOS_ASSERT( it != _pass_through_map.end(), unknown_thunk_exception, "thunk ${id} not found", ( "id", id ) );
-    return std::any_cast< std::function< ThunkReturn( execution_context&, ThunkArgs... ) > >( it->second )( ctx,
-                                                                                                            args... );
+    using thunk_type = ThunkReturn ( * )( execution_context&, ThunkArgs... );
+
+    const auto* entry = find( id );
+    KOINOS_ASSERT( entry != nullptr, unknown_thunk_exception, "thunk ${id} not found", ( "id", id ) );
+
+    if( *entry->type != typeid( thunk_type ) )
+      throw std::bad_any_cast();
+
+    return reinterpret_cast< thunk_type >( entry->thunk )( ctx, args... );
   }
 
   template< typename ArgStruct, typename RetStruct, typename ThunkReturn, typename... ThunkArgs >
   void register_thunk( uint32_t id, ThunkReturn ( *thunk_ptr )( execution_context&, ThunkArgs... ) )
   {
-    std::function< ThunkReturn( execution_context&, ThunkArgs... ) > thunk = thunk_ptr;
-    _dispatch_map.insert_or_assign(
-      id,
-      [ thunk ]( execution_context& ctx,
-                 char* ret_ptr,
-                 uint32_t ret_len,
-                 const char* arg_ptr,
-                 uint32_t arg_len,
-                 uint32_t* bytes_written )
-      {
-        ArgStruct args;
-        ctx.resource_meter().use_compute_bandwidth( ctx.get_compute_bandwidth( "deserialize_message_per_byte" )
-                                                    * arg_len );
-        args.ParseFromArray( arg_ptr, arg_len );
-        detail::call_thunk_impl< ArgStruct, RetStruct >( thunk, ctx, ret_ptr, ret_len, args, bytes_written );
-      } );
-    _pass_through_map.insert_or_assign( id, thunk );
+    auto& entry   = emplace( id );
+    entry.handler = &dispatch< ArgStruct, RetStruct, ThunkReturn, ThunkArgs... >;
+    entry.thunk   = reinterpret_cast< erased_thunk >( thunk_ptr );
+    entry.type    = &typeid( thunk_ptr );
   }
 
   template< typename ArgStruct, typename RetStruct, typename ThunkReturn, typename... ThunkArgs >
   void register_genesis_thunk( uint32_t id, ThunkReturn ( *thunk_ptr )( execution_context&, ThunkArgs... ) )
   {
     register_thunk< ArgStruct, RetStruct, ThunkReturn, ThunkArgs... >( id, thunk_ptr );
-    _genesis_thunks.insert( id );
+    emplace( id ).genesis = true;
   }
 
   bool thunk_exists( uint32_t id ) const;
@@ -407,17 +570,51 @@ public:
 private:
   thunk_dispatcher();
 
-  typedef std::function< void( execution_context&,
-                               char* ret_ptr,
-                               uint32_t ret_len,
-                               const char* arg_ptr,
-                               uint32_t arg_len,
-                               uint32_t* bytes_written ) >
-    generic_thunk_handler;
-
-  std::map< int32_t, generic_thunk_handler > _dispatch_map;
-  std::map< int32_t, std::any > _pass_through_map;
-  std::set< uint32_t > _genesis_thunks;
+  using erased_thunk = void ( * )();
+
+  typedef void ( *generic_thunk_handler )( erased_thunk thunk,
+                                           execution_context&,
+                                           char* ret_ptr,
+                                           uint32_t ret_len,
+                                           const char* arg_ptr,
+                                           uint32_t arg_len,
+                                           uint32_t* bytes_written );
+
+  struct thunk_entry
+  {
+    generic_thunk_handler handler = nullptr;
+    erased_thunk thunk            = nullptr;
+    const std::type_info* type    = nullptr;
+    bool genesis                  = false;
+  };
+
+  template< typename ArgStruct, typename RetStruct, typename ThunkReturn, typename... ThunkArgs >
+  static void dispatch( erased_thunk thunk,
+                        execution_context& ctx,
+                        char* ret_ptr,
+                        uint32_t ret_len,
+                        const char* arg_ptr,
+                        uint32_t arg_len,
+                        uint32_t* bytes_written )
+  {
+    detail::argument_message< ArgStruct > args;
+    ctx.resource_meter().use_compute_bandwidth(
+      ctx.get_compute_bandwidth( compute_cost::deserialize_message_per_byte ) * arg_len );
+    args.get().ParseFromArray( arg_ptr, arg_len );
+    detail::call_thunk_impl< ArgStruct, RetStruct >(
+      reinterpret_cast< ThunkReturn ( * )( execution_context&, ThunkArgs... ) >( thunk ),
+      ctx,
+      ret_ptr,
+      ret_len,
+      args.get(),
+      bytes_written );
+  }
+
+  const thunk_entry* find( uint32_t id ) const;
+  thunk_entry& emplace( uint32_t id );
+
+  std::vector< thunk_entry > _thunk_table;
+  std::map< uint32_t, thunk_entry > _thunk_map;
 };
 
 } // namespace koinos::chain
@@ -273,7 +273,7 @@ std::enable_if_t< std::is_base_of_v< google::protobuf::Message, T >, void > inli
           BOOST_PP_IF( BOOST_VMD_IS_EMPTY( FWD ), , _THUNK_ARG_PACK( FWD ) );                                          \
           std::string _arg_str;                                                                                        \
           _args.SerializeToString( &_arg_str );                                                                        \
-          const auto& _res = context.system_call( _sid, _arg_str );                                                    \
+          const auto& _res = context.system_call( _sid, std::move( _arg_str ) );                                       \
           if( _res.code )                                                                                              \
           {                                                                                                            \
             if( _res.code >= chain::reversion )                                                                        \
@@ -287,11 +287,8 @@ std::enable_if_t< std::is_base_of_v< google::protobuf::Message, T >, void > inli
         }                                                                                                              \
         else                                                                                                           \
         {                                                                                                              \
-          auto _thunk_id   = context.thunk_translation( _sid );                                                        \
-          auto _desc       = chain::system_call_id_descriptor();                                                       \
-          auto _enum_value = _desc->FindValueByNumber( _thunk_id );                                                    \
-          KOINOS_ASSERT( _enum_value, unknown_thunk_exception, "unrecognized thunk id ${id}", ( "id", _thunk_id ) );   \
-          auto _compute = context.get_compute_bandwidth( _enum_value->name() );                                        \
+          auto _thunk_id = context.thunk_translation( _sid );                                                          \
+          auto _compute  = context.get_thunk_compute_bandwidth( _thunk_id );                                           \
           context.resource_meter().use_compute_bandwidth( _compute );                                                  \
           BOOST_PP_IF( _THUNK_IS_VOID( RETURN_TYPE ), , _ret = )                                                       \
           thunk_dispatcher::instance().call_thunk< RETURN_TYPE TYPES >( _thunk_id, context FWD );                      \
@@ -0,0 +1,321 @@
+#include <koinos/chain/verification_memo.hpp>
+#include <koinos/chain/verified_transaction_cache.hpp>
+#include <koinos/chain/worker_pool.hpp>
+
+#include <koinos/crypto/elliptic.hpp>
+#include <koinos/crypto/merkle_tree.hpp>
+#include <koinos/util/conversion.hpp>
+
+#include <type_traits>
+
+namespace koinos::chain {
+
+namespace {
+
+std::string hash_bytes( crypto::multicodec code, const std::string& obj )
+{
+  return util::converter::as< std::string >( crypto::hash( code, obj, crypto::digest_size( 0 ) ) );
+}
+
+// Mirrors thunk::_recover_public_key, returning nothing whenever the thunk would throw
+std::optional< std::string > recover_compressed( const std::string& signature_data, const std::string& digest )
+{
+  if( signature_data.size() != 65 )
+    return {};
+
+  auto signature = util::converter::as< crypto::recoverable_signature >( signature_data );
+
+  if( !crypto::public_key::is_canonical( signature ) )
+    return {};
+
+  auto pub_key = crypto::public_key::recover( signature, util::converter::to< crypto::multihash >( digest ) );
+
+  if( !pub_key.valid() )
+    return {};
+
+  return util::converter::as< std::string >( pub_key );
+}
+
+// Mirrors thunk::_verify_merkle_root, returning nothing whenever the thunk would throw
+std::optional< bool > merkle_root_matches( const std::string& root, const std::vector< std::string >& leaves )
+{
+  auto root_hash = util::converter::to< crypto::multihash >( root );
+
+  std::vector< crypto::multihash > hashes;
+  hashes.reserve( leaves.size() );
+
+  for( const auto& leaf: leaves )
+  {
+    auto mh = util::converter::to< crypto::multihash >( leaf );
+    if( mh.code() != root_hash.code() || mh.digest().size() != root_hash.digest().size() )
+      return {};
+
+    hashes.emplace_back( std::move( mh ) );
+  }
+
+  auto mtree = crypto::merkle_tree( root_hash.code(), hashes );
+  return mtree.root()->hash() == root_hash;
+}
+
+} // namespace
+
+std::shared_ptr< const verified_transaction > verify_transaction( const protocol::transaction& trx,
+                                                                  crypto::multicodec code )
+{
+  auto facts  = std::make_shared< verified_transaction >();
+  facts->code = code;
+
+  auto header        = util::converter::as< std::string >( trx.header() );
+  facts->header_hash = hash_bytes( code, header );
+  facts->hashes.emplace_back( verified_transaction::hashed_object{ std::move( header ), facts->header_hash } );
+
+  std::string signatures;
+  for( const auto& sig: trx.signatures() )
+    signatures.append( sig );
+
+  facts->signatures_hash = hash_bytes( code, signatures );
+  facts->hashes.emplace_back( verified_transaction::hashed_object{ std::move( signatures ), facts->signatures_hash } );
+
+  facts->operation_hashes.reserve( trx.operations_size() );
+  for( const auto& op: trx.operations() )
+  {
+    auto op_bytes = util::converter::as< std::string >( op );
+    facts->operation_hashes.emplace_back( hash_bytes( code, op_bytes ) );
+    facts->hashes.emplace_back(
+      verified_transaction::hashed_object{ std::move( op_bytes ), facts->operation_hashes.back() } );
+  }
+
+  try
+  {
+    facts->operation_root_matches = merkle_root_matches( trx.header().operation_merkle_root(),
+                                                         facts->operation_hashes );
+  }
+  catch( ... )
+  {}
+
+  for( const auto& sig: trx.signatures() )
+  {
+    try
+    {
+      if( auto pub_key = recover_compressed( sig, trx.id() ); pub_key )
+        facts->keys.emplace_back( verified_transaction::recovered_key{ sig, trx.id(), std::move( *pub_key ) } );
+    }
+    catch( ... )
+    {}
+  }
+
+  return facts;
+}
+
+bool verified_transaction::verifies( const protocol::transaction& trx, crypto::multicodec trx_code ) const
+{
+  if( code != trx_code || hashes.size() != std::size_t( trx.operations_size() ) + 2 )
+    return false;
+
+  if( hashes[ 0 ].obj != util::converter::as< std::string >( trx.header() ) )
+    return false;
+
+  std::size_t signatures_size = 0;
+  for( const auto& sig: trx.signatures() )
+    signatures_size += sig.size();
+
+  if( hashes[ 1 ].obj.size() != signatures_size )
+    return false;
+
+  std::size_t offset = 0;
+  for( const auto& sig: trx.signatures() )
+  {
+    if( hashes[ 1 ].obj.compare( offset, sig.size(), sig ) != 0 )
+      return false;
+
+    offset += sig.size();
+  }
+
+  for( int i = 0; i < trx.operations_size(); i++ )
+    if( hashes[ i + 2 ].obj != util::converter::as< std::string >( trx.operations( i ) ) )
+      return false;
+
+  return true;
+}
+
+void verification_memo::add_transaction( const protocol::transaction& trx,
+                                         std::shared_ptr< const verified_transaction > facts )
+{
+  const auto code_value = std::underlying_type_t< crypto::multicodec >( facts->code );
+
+  for( const auto& h: facts->hashes )
+    index_hash( code_value, h, 0 );
+
+  for( const auto& k: facts->keys )
+    index_public_key( k );
+
+  if( facts->operation_root_matches )
+    add_merkle_root( trx.header().operation_merkle_root(), facts->operation_hashes, *facts->operation_root_matches );
+
+  _transactions.emplace_back( std::move( facts ) );
+}
+
+void verification_memo::add_hash( uint64_t code, std::string obj, uint64_t size, std::string digest )
+{
+  index_hash( code,
+              _objects.emplace_back( verified_transaction::hashed_object{ std::move( obj ), std::move( digest ) } ),
+              size );
+}
+
+void verification_memo::index_hash( uint64_t code, const verified_transaction::hashed_object& h, uint64_t size )
+{
+  _hashes.try_emplace( h.obj, hash_entry{ code, size, &h.digest } );
+}
+
+const std::string* verification_memo::find_hash( uint64_t code, const std::string& obj, uint64_t size ) const
+{
+  auto itr = _hashes.find( obj );
+  if( itr == _hashes.end() || itr->second.code != code || itr->second.size != size )
+    return nullptr;
+
+  return itr->second.digest;
+}
+
+void verification_memo::add_public_key( std::string signature, std::string digest, std::string public_key )
+{
+  index_public_key( _keys.emplace_back(
+    verified_transaction::recovered_key{ std::move( signature ), std::move( digest ), std::move( public_key ) } ) );
+}
+
+void verification_memo::index_public_key( const verified_transaction::recovered_key& k )
+{
+  _public_keys.try_emplace( k.signature, public_key_entry{ &k.digest, &k.public_key } );
+}
+
+const std::string* verification_memo::find_public_key( const std::string& signature, const std::string& digest ) const
+{
+  auto itr = _public_keys.find( signature );
+  if( itr == _public_keys.end() || *itr->second.digest != digest )
+    return nullptr;
+
+  return itr->second.public_key;
+}
+
+void verification_memo::add_merkle_root( const std::string& root, std::vector< std::string > leaves, bool matches )
+{
+  _merkle_roots.try_emplace( root, merkle_entry{ std::move( leaves ), matches } );
+}
+
+std::optional< bool > verification_memo::find_merkle_root( const std::string& root,
+                                                           const std::vector< std::string >& leaves ) const
+{
+  auto itr = _merkle_roots.find( root );
+  if( itr == _merkle_roots.end() || itr->second.leaves != leaves )
+    return {};
+
+  return itr->second.matches;
+}
+
+std::size_t verification_memo::size() const
+{
+  return _hashes.size() + _public_keys.size() + _merkle_roots.size();
+}
+
+namespace {
+
+std::shared_ptr< const verification_memo > build_block_memo( worker_pool* pool,
+                                                             const protocol::block& block,
+                                                             crypto::multicodec code,
+                                                             verified_transaction_cache* cache )
+{
+  const auto num_transactions = std::size_t( block.transactions_size() );
+
+  std::vector< std::shared_ptr< const verified_transaction > > transactions( num_transactions );
+
+  if( cache )
+    for( std::size_t i = 0; i < num_transactions; i++ )
+      transactions[ i ] = cache->find( block.transactions( int( i ) ), code );
+
+  std::string header;
+  std::string header_hash;
+  std::optional< std::string > block_signer;
+
+  // Index num_transactions is the block header itself
+  auto verify = [ & ]( std::size_t i )
+  {
+    try
+    {
+      if( i == num_transactions )
+      {
+        header       = util::converter::as< std::string >( block.header() );
+        header_hash  = hash_bytes( code, header );
+        block_signer = recover_compressed( block.signature(), header_hash );
+      }
+      else if( !transactions[ i ] )
+      {
+        transactions[ i ] = verify_transaction( block.transactions( int( i ) ), code );
+      }
+    }
+    catch( ... )
+    {}
+  };
+
+  // Without a pool, only what has already been verified is remembered and the thunks do the rest
+  if( pool )
+    pool->parallel_for( num_transactions + 1, verify );
+
+  auto memo             = std::make_shared< verification_memo >();
+  const auto code_value = std::underlying_type_t< crypto::multicodec >( code );
+
+  if( header_hash.size() )
+  {
+    if( block_signer )
+      memo->add_public_key( block.signature(), header_hash, std::move( *block_signer ) );
+
+    memo->add_hash( code_value, std::move( header ), 0, std::move( header_hash ) );
+  }
+
+  bool all_completed = true;
+  std::vector< std::string > leaves;
+  leaves.reserve( num_transactions * 2 );
+
+  for( std::size_t i = 0; i < num_transactions; i++ )
+  {
+    if( !transactions[ i ] )
+    {
+      all_completed = false;
+      continue;
+    }
+
+    leaves.emplace_back( transactions[ i ]->header_hash );
+    leaves.emplace_back( transactions[ i ]->signatures_hash );
+
+    memo->add_transaction( block.transactions( int( i ) ), std::move( transactions[ i ] ) );
+  }
+
+  if( all_completed )
+  {
+    try
+    {
+      if( auto matches = merkle_root_matches( block.header().transaction_merkle_root(), leaves ); matches )
+        memo->add_merkle_root( block.header().transaction_merkle_root(), std::move( leaves ), *matches );
+    }
+    catch( ... )
+    {}
+  }
+
+  return memo;
+}
+
+} // namespace
+
+std::shared_ptr< const verification_memo > prevalidate_block( worker_pool& pool,
+                                                              const protocol::block& block,
+                                                              crypto::multicodec code,
+                                                              verified_transaction_cache* cache )
+{
+  return build_block_memo( &pool, block, code, cache );
+}
+
+std::shared_ptr< const verification_memo >
+recall_block( const protocol::block& block, crypto::multicodec code, verified_transaction_cache& cache )
+{
+  return build_block_memo( nullptr, block, code, &cache );
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <koinos/crypto/multihash.hpp>
+#include <koinos/protocol/protocol.pb.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace koinos::chain {
+
+class worker_pool;
+class verified_transaction_cache;
+
+/**
+ * The state independent facts about a transaction: the hashes of its header, signatures and operations,
+ * whether its operation merkle root matches, and the public keys recovered from its signatures.
+ */
+struct verified_transaction
+{
+  struct hashed_object
+  {
+    std::string obj;
+    std::string digest;
+  };
+
+  struct recovered_key
+  {
+    std::string signature;
+    std::string digest;
+    std::string public_key;
+  };
+
+  crypto::multicodec code;
+  std::vector< hashed_object > hashes;
+  std::vector< recovered_key > keys;
+  std::string header_hash;
+  std::string signatures_hash;
+  std::vector< std::string > operation_hashes;
+  std::optional< bool > operation_root_matches;
+
+  // Whether these facts were computed from exactly this transaction
+  bool verifies( const protocol::transaction& trx, crypto::multicodec trx_code ) const;
+};
+
+/**
+ * Computes the verified facts of a transaction. Work that fails is left out so that the thunks
+ * reproduce the error.
+ */
+std::shared_ptr< const verified_transaction > verify_transaction( const protocol::transaction& trx,
+                                                                  crypto::multicodec code );
+
+/**
+ * Results of state independent verification work (hashes, merkle roots and public key recovery)
+ * that was performed ahead of executing a block.
+ *
+ * Entries are keyed by their complete inputs, so a lookup only ever returns the result the
+ * corresponding thunk would have computed itself. A miss simply means the thunk does the work.
+ * The memo holds on to the verified transactions it is built from and keys their objects in place
+ * rather than copying them.
+ */
+class verification_memo final
+{
+public:
+  verification_memo()                                      = default;
+  verification_memo( const verification_memo& )            = delete;
+  verification_memo& operator=( const verification_memo& ) = delete;
+
+  void add_hash( uint64_t code, std::string obj, uint64_t size, std::string digest );
+  const std::string* find_hash( uint64_t code, const std::string& obj, uint64_t size ) const;
+
+  void add_public_key( std::string signature, std::string digest, std::string public_key );
+  const std::string* find_public_key( const std::string& signature, const std::string& digest ) const;
+
+  void add_merkle_root( const std::string& root, std::vector< std::string > leaves, bool matches );
+  std::optional< bool > find_merkle_root( const std::string& root, const std::vector< std::string >& leaves ) const;
+
+  void add_transaction( const protocol::transaction& trx, std::shared_ptr< const verified_transaction > facts );
+
+  std::size_t size() const;
+
+private:
+  struct hash_entry
+  {
+    uint64_t code;
+    uint64_t size;
+    const std::string* digest;
+  };
+
+  struct public_key_entry
+  {
+    const std::string* digest;
+    const std::string* public_key;
+  };
+
+  struct merkle_entry
+  {
+    std::vector< std::string > leaves;
+    bool matches;
+  };
+
+  void index_hash( uint64_t code, const verified_transaction::hashed_object& h, uint64_t size );
+  void index_public_key( const verified_transaction::recovered_key& k );
+
+  // Owners of the bytes the maps below are keyed by, deques keep them in place as they grow
+  std::vector< std::shared_ptr< const verified_transaction > > _transactions;
+  std::deque< verified_transaction::hashed_object > _objects;
+  std::deque< verified_transaction::recovered_key > _keys;
+
+  std::unordered_map< std::string_view, hash_entry > _hashes;
+  std::unordered_map< std::string_view, public_key_entry > _public_keys;
+  std::unordered_map< std::string, merkle_entry > _merkle_roots;
+};
+
+/**
+ * Hashes every header, signature bundle and operation in the block, checks the transaction and
+ * operation merkle roots, and recovers the block and transaction signatures across the worker pool.
+ *
+ * Work that fails for any reason is left out of the memo so that the thunks reproduce the error.
+ * Transactions found in the cache are not verified again.
+ */
+std::shared_ptr< const verification_memo > prevalidate_block( worker_pool& pool,
+                                                              const protocol::block& block,
+                                                              crypto::multicodec code,
+                                                              verified_transaction_cache* cache = nullptr );
+
+/**
+ * Builds a memo from the transactions of the block found in the cache, without verifying anything.
+ */
+std::shared_ptr< const verification_memo >
+recall_block( const protocol::block& block, crypto::multicodec code, verified_transaction_cache& cache );
+
+} // namespace koinos::chain
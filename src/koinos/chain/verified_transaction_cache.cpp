@@ -0,0 +1,73 @@
+#include <koinos/chain/verified_transaction_cache.hpp>
+
+#include <algorithm>
+
+namespace koinos::chain {
+
+verified_transaction_cache::verified_transaction_cache( std::size_t max_transactions ):
+    _max_transactions( std::max( max_transactions, std::size_t( 1 ) ) )
+{}
+
+std::shared_ptr< const verified_transaction > verified_transaction_cache::find( const protocol::transaction& trx,
+                                                                                crypto::multicodec code )
+{
+  std::shared_ptr< const verified_transaction > facts;
+
+  {
+    std::lock_guard< std::mutex > lock( _mutex );
+
+    auto itr = _entry_map.find( trx.id() );
+    if( itr == _entry_map.end() )
+      return {};
+
+    // Move the entry to the front of the list
+    _lru_list.splice( _lru_list.begin(), _lru_list, itr->second.second );
+    facts = itr->second.first;
+  }
+
+  // A transaction reusing the id of another is verified from scratch
+  if( !facts->verifies( trx, code ) )
+    return {};
+
+  std::lock_guard< std::mutex > lock( _mutex );
+  _hits++;
+
+  return facts;
+}
+
+void verified_transaction_cache::add( const protocol::transaction& trx,
+                                      std::shared_ptr< const verified_transaction > facts )
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+
+  if( auto itr = _entry_map.find( trx.id() ); itr != _entry_map.end() )
+  {
+    itr->second.first = std::move( facts );
+    _lru_list.splice( _lru_list.begin(), _lru_list, itr->second.second );
+    return;
+  }
+
+  // If the cache is full, evict the least recently used transaction
+  if( _lru_list.size() >= _max_transactions )
+  {
+    _entry_map.erase( _lru_list.back() );
+    _lru_list.pop_back();
+  }
+
+  _lru_list.push_front( trx.id() );
+  _entry_map.emplace( trx.id(), std::make_pair( std::move( facts ), _lru_list.begin() ) );
+}
+
+std::size_t verified_transaction_cache::size() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _lru_list.size();
+}
+
+uint64_t verified_transaction_cache::hits() const
+{
+  std::lock_guard< std::mutex > lock( _mutex );
+  return _hits;
+}
+
+} // namespace koinos::chain
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <koinos/chain/verification_memo.hpp>
+
+#include <koinos/crypto/multihash.hpp>
+#include <koinos/protocol/protocol.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace koinos::chain {
+
+/**
+ * A bounded cache of the verified facts of transactions, shared between the submit and block paths.
+ *
+ * Entries are keyed by transaction id, but are only returned for a transaction whose header, signatures
+ * and operations match the ones the facts were computed from. The least recently used entry is evicted
+ * once the cache is full.
+ */
+class verified_transaction_cache final
+{
+public:
+  static constexpr std::size_t default_max_transactions = 8'192;
+
+  verified_transaction_cache( std::size_t max_transactions = default_max_transactions );
+
+  std::shared_ptr< const verified_transaction > find( const protocol::transaction& trx, crypto::multicodec code );
+  void add( const protocol::transaction& trx, std::shared_ptr< const verified_transaction > facts );
+
+  std::size_t size() const;
+  uint64_t hits() const;
+
+private:
+  using lru_list_type = std::list< std::string >;
+  using entry_map_type =
+    std::unordered_map< std::string,
+                        std::pair< std::shared_ptr< const verified_transaction >, typename lru_list_type::iterator > >;
+
+  mutable std::mutex _mutex;
+  lru_list_type _lru_list;
+  entry_map_type _entry_map;
+  uint64_t _hits = 0;
+  const std::size_t _max_transactions;
+};
+
+} // namespace koinos::chain
@@ -0,0 +1,92 @@
+#include <koinos/chain/worker_pool.hpp>
+
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace koinos::chain {
+
+worker_pool::worker_pool( std::size_t num_threads ):
+    _size( std::max( num_threads, std::size_t( 1 ) ) ),
+    _pool( _size )
+{}
+
+worker_pool::~worker_pool()
+{
+  _pool.join();
+}
+
+std::size_t worker_pool::size() const
+{
+  return _size;
+}
+
+void worker_pool::parallel_for( std::size_t n, const std::function< void( std::size_t ) >& f )
+{
+  if( n == 0 )
+    return;
+
+  struct shared_state
+  {
+    std::atomic< std::size_t > next = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t running = 0;
+    std::exception_ptr exception;
+  };
+
+  auto state = std::make_shared< shared_state >();
+
+  auto work = [ state, n, &f ]()
+  {
+    for( auto i = state->next.fetch_add( 1 ); i < n; i = state->next.fetch_add( 1 ) )
+    {
+      try
+      {
+        f( i );
+      }
+      catch( ... )
+      {
+        std::lock_guard< std::mutex > lock( state->mutex );
+        if( !state->exception )
+          state->exception = std::current_exception();
+      }
+    }
+  };
+
+  // The calling thread takes a share of the work, so we only need to wake up n - 1 workers at most
+  auto helpers   = std::min( _size, n - 1 );
+  state->running = helpers;
+
+  for( std::size_t i = 0; i < helpers; i++ )
+  {
+    boost::asio::post( _pool,
+                       [ state, work ]()
+                       {
+                         work();
+
+                         std::lock_guard< std::mutex > lock( state->mutex );
+                         if( --state->running == 0 )
+                           state->cv.notify_all();
+                       } );
+  }
+
+  work();
+
+  std::unique_lock< std::mutex > lock( state->mutex );
+  state->cv.wait( lock,
+                  [ & ]()
+                  {
+                    return state->running == 0;
+                  } );
+
+  if( state->exception )
+    std::rethrow_exception( state->exception );
+}
+
+} // namespace koinos::chain
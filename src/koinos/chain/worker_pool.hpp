@@ -0,0 +1,35 @@
+#pragma once
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace koinos::chain {
+
+/**
+ * A fixed size pool of worker threads used for embarrassingly parallel work on the block path.
+ *
+ * The calling thread participates in parallel_for. Calling parallel_for from within a worker is not supported.
+ */
+class worker_pool final
+{
+public:
+  worker_pool( std::size_t num_threads );
+  ~worker_pool();
+
+  std::size_t size() const;
+
+  /**
+   * Calls f( i ) for every i in [0, n) and blocks until all calls have returned.
+   *
+   * If any call throws, the first exception is rethrown once every call has finished.
+   */
+  void parallel_for( std::size_t n, const std::function< void( std::size_t ) >& f );
+
+private:
+  std::size_t _size;
+  boost::asio::thread_pool _pool;
+};
+
+} // namespace koinos::chain
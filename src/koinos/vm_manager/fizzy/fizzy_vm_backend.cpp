@@ -10,12 +10,13 @@
 #include <iostream>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace koinos::vm_manager::fizzy {
 
 namespace constants {
-constexpr uint32_t fizzy_max_call_depth = 251;
-constexpr std::size_t module_cache_size = 32;
+constexpr uint32_t fizzy_max_call_depth   = 251;
+constexpr std::size_t max_pooled_contexts = 64;
 } // namespace constants
 
 /**
@@ -48,9 +49,7 @@ char* resolve_ptr( FizzyInstance* fizzy_instance, uint32_t ptr, uint32_t size )
   return mem_data + ptr;
 }
 
-fizzy_vm_backend::fizzy_vm_backend():
-    _cache( constants::module_cache_size )
-{}
+fizzy_vm_backend::fizzy_vm_backend() {}
 
 fizzy_vm_backend::~fizzy_vm_backend() {}
 
@@ -82,6 +81,52 @@ std::string fizzy_error_code_name( FizzyErrorCode code ) noexcept
   }
 }
 
+/**
+ * Metered execution contexts are reusable once an execution has unwound, as only their ticks differ.
+ *
+ * Each nested contract call holds its own context for the duration of the call, so contexts are pooled
+ * per thread rather than created and freed around every call.
+ */
+class execution_context_pool
+{
+public:
+  ~execution_context_pool()
+  {
+    for( auto* context: _contexts )
+      fizzy_free_execution_context( context );
+  }
+
+  FizzyExecutionContext* acquire( int64_t ticks )
+  {
+    if( _contexts.empty() )
+      return fizzy_create_metered_execution_context( constants::fizzy_max_call_depth, ticks );
+
+    auto* context = _contexts.back();
+    _contexts.pop_back();
+
+    auto* context_ticks = fizzy_get_execution_context_ticks( context );
+    KOINOS_ASSERT( context_ticks != nullptr,
+                   fizzy_returned_null_exception,
+                   "fizzy_get_execution_context_ticks() unexpectedly returned null pointer" );
+    *context_ticks = ticks;
+
+    return context;
+  }
+
+  void release( FizzyExecutionContext* context )
+  {
+    if( _contexts.size() < constants::max_pooled_contexts )
+      _contexts.push_back( context );
+    else
+      fizzy_free_execution_context( context );
+  }
+
+private:
+  std::vector< FizzyExecutionContext* > _contexts;
+};
+
+thread_local execution_context_pool context_pool;
+
 class fizzy_runner
 {
 public:
@@ -113,7 +158,7 @@ fizzy_runner::~fizzy_runner()
     fizzy_free_instance( _instance );
 
   if( _fizzy_context != nullptr )
-    fizzy_free_execution_context( _fizzy_context );
+    context_pool.release( _fizzy_context );
 }
 
 module_ptr parse_bytecode( const char* bytecode_data, size_t bytecode_size )
@@ -258,7 +303,7 @@ FizzyExecutionResult fizzy_runner::_invoke_thunk( const FizzyValue* args,
     _exception = std::current_exception();
   }
 
-  result.trapped = !!_exception;
+  result.trapped = !!_exception || _hapi.exited();
   return result;
 }
 
@@ -308,7 +353,7 @@ FizzyExecutionResult fizzy_runner::_invoke_system_call( const FizzyValue* args,
     _exception = std::current_exception();
   }
 
-  result.trapped = !!_exception;
+  result.trapped = !!_exception || _hapi.exited();
   return result;
 }
 
@@ -316,14 +361,13 @@ void fizzy_runner::call_start()
 {
   KOINOS_ASSERT( _fizzy_context == nullptr, runner_state_exception, "_fizzy_context was unexpectedly non-null" );
   _previous_ticks = _hapi.get_meter_ticks();
-  _fizzy_context  = fizzy_create_metered_execution_context( constants::fizzy_max_call_depth, _previous_ticks );
+  _fizzy_context  = context_pool.acquire( _previous_ticks );
   KOINOS_ASSERT( _fizzy_context != nullptr, create_context_exception, "could not create execution context" );
 
-  uint32_t start_func_idx = 0;
-  bool success            = fizzy_find_exported_function_index( _module->get(), "_start", &start_func_idx );
-  KOINOS_ASSERT( success, module_start_exception, "module does not have _start function" );
+  const auto& start_func_idx = _module->start_index();
+  KOINOS_ASSERT( start_func_idx, module_start_exception, "module does not have _start function" );
 
-  FizzyExecutionResult result = fizzy_execute( _instance, start_func_idx, nullptr, _fizzy_context );
+  FizzyExecutionResult result = fizzy_execute( _instance, *start_func_idx, nullptr, _fizzy_context );
 
   int64_t* ticks = fizzy_get_execution_context_ticks( _fizzy_context );
   KOINOS_ASSERT( ticks != nullptr,
@@ -338,7 +382,8 @@ void fizzy_runner::call_start()
     std::rethrow_exception( exc );
   }
 
-  if( result.trapped )
+  // An exited contract traps to stop execution, but is not an error
+  if( result.trapped && !_hapi.exited() )
   {
     KOINOS_THROW( wasm_trap_exception, "module exited due to trap" );
   }
@@ -354,7 +399,7 @@ void fizzy_vm_backend::run( abstract_host_api& hapi, const std::string& bytecode
     if( !ptr )
     {
       ptr = parse_bytecode( bytecode.data(), bytecode.size() );
-      _cache.put_module( id, ptr );
+      _cache.put_module( id, ptr, bytecode.size() );
     }
   }
   else
@@ -367,4 +412,43 @@ void fizzy_vm_backend::run( abstract_host_api& hapi, const std::string& bytecode
   runner.call_start();
 }
 
+void fizzy_vm_backend::run_cached( abstract_host_api& hapi, const std::string& id, const bytecode_loader& load )
+{
+  if( id.empty() )
+  {
+    run( hapi, load(), id );
+    return;
+  }
+
+  module_ptr ptr = _cache.get_module( id );
+  if( !ptr )
+  {
+    const auto& bytecode = load();
+    ptr                  = parse_bytecode( bytecode.data(), bytecode.size() );
+    _cache.put_module( id, ptr, bytecode.size() );
+  }
+
+  fizzy_runner runner( hapi, ptr );
+  runner.instantiate_module();
+  runner.call_start();
+}
+
+void fizzy_vm_backend::prewarm( const std::string& id, const std::string& bytecode )
+{
+  if( id.empty() || _cache.contains( id ) )
+    return;
+
+  _cache.put_module( id, parse_bytecode( bytecode.data(), bytecode.size() ), bytecode.size() );
+}
+
+void fizzy_vm_backend::set_module_cache_size( std::size_t bytes )
+{
+  _cache.set_max_bytes( bytes );
+}
+
+module_cache_stats fizzy_vm_backend::get_module_cache_stats() const
+{
+  return _cache.stats();
+}
+
 } // namespace koinos::vm_manager::fizzy
@@ -22,6 +22,11 @@ public:
   virtual void initialize();
 
   virtual void run( abstract_host_api& hapi, const std::string& bytecode, const std::string& id = std::string() );
+  virtual void run_cached( abstract_host_api& hapi, const std::string& id, const bytecode_loader& load );
+
+  virtual void prewarm( const std::string& id, const std::string& bytecode );
+  virtual void set_module_cache_size( std::size_t bytes );
+  virtual module_cache_stats get_module_cache_stats() const;
 
 private:
   module_cache _cache;
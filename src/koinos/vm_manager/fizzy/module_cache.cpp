@@ -1,52 +1,209 @@
 #include <koinos/vm_manager/fizzy/exceptions.hpp>
 #include <koinos/vm_manager/fizzy/module_cache.hpp>
 
+#include <algorithm>
+#include <array>
+#include <functional>
+
 namespace koinos::vm_manager::fizzy {
 
-module_cache::module_cache( std::size_t size ):
-    _cache_size( size )
+namespace constants {
+constexpr std::size_t sketch_width                   = 1'024;
+constexpr std::size_t sketch_samples_per_counter     = 10;
+constexpr std::array< uint64_t, 4 > sketch_row_seeds = { 0x9e37'79b9'7f4a'7c15,
+                                                          0xc2b2'ae3d'27d4'eb4f,
+                                                          0x1656'67b1'9e37'79f9,
+                                                          0x27d4'eb2f'1656'67c5 };
+} // namespace constants
+
+frequency_sketch::frequency_sketch( std::size_t width ):
+    _counters( depth * width ),
+    _mask( width - 1 ),
+    _sample_size( width * constants::sketch_samples_per_counter )
 {}
 
+std::size_t frequency_sketch::index( std::size_t hash, std::size_t row ) const
+{
+  uint64_t h = ( uint64_t( hash ) + constants::sketch_row_seeds[ row ] ) * constants::sketch_row_seeds[ 0 ];
+  return row * ( _mask + 1 ) + ( ( h >> 32 ) & _mask );
+}
+
+void frequency_sketch::increment( std::size_t hash )
+{
+  for( std::size_t row = 0; row < depth; row++ )
+  {
+    auto& counter = _counters[ index( hash, row ) ];
+    if( counter < max_frequency )
+      counter++;
+  }
+
+  if( ++_additions >= _sample_size )
+    age();
+}
+
+uint8_t frequency_sketch::estimate( std::size_t hash ) const
+{
+  uint8_t frequency = max_frequency;
+
+  for( std::size_t row = 0; row < depth; row++ )
+    frequency = std::min( frequency, _counters[ index( hash, row ) ] );
+
+  return frequency;
+}
+
+void frequency_sketch::age()
+{
+  for( auto& counter: _counters )
+    counter >>= 1;
+
+  _additions /= 2;
+}
+
+module_cache::shard::shard():
+    sketch( constants::sketch_width )
+{}
+
+module_cache::module_cache( std::size_t max_bytes, std::size_t shards )
+{
+  shards = std::max( shards, std::size_t( 1 ) );
+
+  for( std::size_t i = 0; i < shards; i++ )
+    _shards.emplace_back( std::make_unique< shard >() );
+
+  set_max_bytes( max_bytes );
+}
+
 module_cache::~module_cache()
 {
-  std::lock_guard< std::mutex > lock( _mutex );
-  _module_map.clear();
+  for( auto& s: _shards )
+  {
+    std::lock_guard< std::mutex > lock( s->mutex );
+    s->module_map.clear();
+  }
+}
+
+module_cache::shard& module_cache::get_shard( std::size_t hash )
+{
+  return *_shards[ hash % _shards.size() ];
 }
 
 module_ptr module_cache::get_module( const std::string& id )
 {
-  std::lock_guard< std::mutex > lock( _mutex );
+  auto hash = std::hash< std::string >{}( id );
+  auto& s   = get_shard( hash );
+
+  std::lock_guard< std::mutex > lock( s.mutex );
 
-  auto itr = _module_map.find( id );
-  if( itr == _module_map.end() )
+  s.sketch.increment( hash );
+
+  auto itr = s.module_map.find( id );
+  if( itr == s.module_map.end() )
+  {
+    _misses.fetch_add( 1, std::memory_order_relaxed );
     return module_ptr();
+  }
 
-  // Erase the entry from the list and push front
-  _lru_list.erase( itr->second.second );
-  _lru_list.push_front( id );
-  auto ptr          = itr->second.first;
-  _module_map[ id ] = std::make_pair( ptr, _lru_list.begin() );
+  // Move the entry to the front of the list
+  s.lru_list.splice( s.lru_list.begin(), s.lru_list, itr->second.lru_itr );
 
-  return ptr;
+  _hits.fetch_add( 1, std::memory_order_relaxed );
+  return itr->second.module;
 }
 
-void module_cache::put_module( const std::string& id, module_ptr module )
+bool module_cache::contains( const std::string& id )
 {
-  std::lock_guard< std::mutex > lock( _mutex );
+  auto& s = get_shard( std::hash< std::string >{}( id ) );
+
+  std::lock_guard< std::mutex > lock( s.mutex );
+  return s.module_map.find( id ) != s.module_map.end();
+}
 
-  // If the cache is full, remove the last entry from the map, free the fizzy module, and pop back
-  if( _lru_list.size() >= _cache_size )
+void module_cache::put_module( const std::string& id, module_ptr module, std::size_t size )
+{
+  auto hash = std::hash< std::string >{}( id );
+  auto& s   = get_shard( hash );
+
+  if( size > _max_bytes.load() )
   {
-    const auto key = _lru_list.back();
-    auto it        = _module_map.find( key );
-    if( it != _module_map.end() )
-      _module_map.erase( it );
+    _rejections.fetch_add( 1, std::memory_order_relaxed );
+    return;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( s.mutex );
+
+    if( s.module_map.find( id ) != s.module_map.end() )
+      return;
+
+    // A full cache only admits a module that is used more often than the least recently used one of its shard
+    if( _bytes.load() + size > _max_bytes.load() && !s.lru_list.empty()
+        && s.sketch.estimate( hash ) <= s.sketch.estimate( std::hash< std::string >{}( s.lru_list.back() ) ) )
+    {
+      _rejections.fetch_add( 1, std::memory_order_relaxed );
+      return;
+    }
+
+    while( _bytes.load() + size > _max_bytes.load() && !s.lru_list.empty() )
+      evict( s );
+
+    s.lru_list.push_front( id );
+    s.module_map.emplace( id,
+                          cache_entry{ .module = std::move( module ), .size = size, .lru_itr = s.lru_list.begin() } );
+    s.bytes += size;
+    _bytes += size;
+  }
+
+  // The shard did not hold enough to make room, so the rest comes from the others
+  if( _bytes.load() > _max_bytes.load() )
+    trim( &s );
+}
 
-    _lru_list.pop_back();
+void module_cache::evict( shard& s )
+{
+  auto victim = s.module_map.find( s.lru_list.back() );
+  s.bytes -= victim->second.size;
+  _bytes -= victim->second.size;
+  s.module_map.erase( victim );
+  s.lru_list.pop_back();
+  _evictions.fetch_add( 1, std::memory_order_relaxed );
+}
+
+void module_cache::trim( const shard* keep )
+{
+  for( std::size_t i = 0; i < _shards.size() && _bytes.load() > _max_bytes.load(); i++ )
+  {
+    auto& s = *_shards[ _next_trim++ % _shards.size() ];
+    if( &s == keep )
+      continue;
+
+    std::lock_guard< std::mutex > lock( s.mutex );
+
+    while( _bytes.load() > _max_bytes.load() && !s.lru_list.empty() )
+      evict( s );
+  }
+}
+
+void module_cache::set_max_bytes( std::size_t max_bytes )
+{
+  _max_bytes = max_bytes;
+  trim();
+}
+
+module_cache_stats module_cache::stats() const
+{
+  module_cache_stats stats{ .hits       = _hits.load( std::memory_order_relaxed ),
+                            .misses     = _misses.load( std::memory_order_relaxed ),
+                            .evictions  = _evictions.load( std::memory_order_relaxed ),
+                            .rejections = _rejections.load( std::memory_order_relaxed ) };
+
+  for( const auto& s: _shards )
+  {
+    std::lock_guard< std::mutex > lock( s->mutex );
+    stats.bytes += s->bytes;
+    stats.modules += s->module_map.size();
   }
 
-  _lru_list.push_front( id );
-  _module_map[ id ] = std::make_pair( module, _lru_list.begin() );
+  return stats;
 }
 
 } // namespace koinos::vm_manager::fizzy
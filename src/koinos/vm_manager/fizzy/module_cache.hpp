@@ -1,10 +1,17 @@
 #include <fizzy/fizzy.h>
 
+#include <koinos/vm_manager/vm_backend.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <list>
-#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace koinos::vm_manager::fizzy {
 
@@ -12,11 +19,16 @@ class module_guard
 {
 private:
   const FizzyModule* _module;
+  std::optional< uint32_t > _start_index;
 
 public:
   module_guard( const FizzyModule* m ):
       _module( m )
-  {}
+  {
+    uint32_t index = 0;
+    if( fizzy_find_exported_function_index( _module, "_start", &index ) )
+      _start_index = index;
+  }
 
   ~module_guard()
   {
@@ -27,28 +39,107 @@ public:
   {
     return _module;
   }
+
+  // The index of the exported _start function, resolved once when the module is parsed
+  const std::optional< uint32_t >& start_index() const
+  {
+    return _start_index;
+  }
 };
 
 using module_ptr = std::shared_ptr< const module_guard >;
 
-class module_cache
+/**
+ * An approximate count of recent accesses per key, in a count-min sketch of small saturating counters.
+ *
+ * Counters are halved after a sample of accesses so that the frequency of a key reflects recent use.
+ */
+class frequency_sketch
 {
+public:
+  frequency_sketch( std::size_t width );
+
+  void increment( std::size_t hash );
+  uint8_t estimate( std::size_t hash ) const;
+
 private:
-  using lru_list_type = std::list< std::string >;
+  static constexpr std::size_t depth     = 4;
+  static constexpr uint8_t max_frequency = 15;
 
-  using module_map_type = std::map< std::string, std::pair< module_ptr, typename lru_list_type::iterator > >;
+  std::size_t index( std::size_t hash, std::size_t row ) const;
+  void age();
 
-  lru_list_type _lru_list;
-  module_map_type _module_map;
-  std::mutex _mutex;
-  const std::size_t _cache_size;
+  std::vector< uint8_t > _counters;
+  std::size_t _mask;
+  std::size_t _sample_size;
+  std::size_t _additions = 0;
+};
 
+/**
+ * A concurrent cache of parsed modules, bounded by the size of the bytecode they were parsed from.
+ *
+ * Modules are spread over independently locked shards, each with its own LRU order, and share a single byte budget.
+ * When the cache is full, a new module is only admitted if it has been accessed more often recently than the module
+ * it would evict from its shard (TinyLFU), so that a scan of rarely called contracts cannot flush the frequently
+ * called ones. Any module that fits within the budget can be cached, whichever shard it lands in.
+ */
+class module_cache
+{
 public:
-  module_cache( std::size_t size );
+  static constexpr std::size_t default_max_bytes = 32 * 1'024 * 1'024;
+  static constexpr std::size_t default_shards    = 16;
+
+  module_cache( std::size_t max_bytes = default_max_bytes, std::size_t shards = default_shards );
   ~module_cache();
 
   module_ptr get_module( const std::string& id );
-  void put_module( const std::string& id, module_ptr module );
+  void put_module( const std::string& id, module_ptr module, std::size_t size );
+
+  // Whether id is cached, without counting as an access
+  bool contains( const std::string& id );
+
+  void set_max_bytes( std::size_t max_bytes );
+  module_cache_stats stats() const;
+
+private:
+  using lru_list_type = std::list< std::string >;
+
+  struct cache_entry
+  {
+    module_ptr module;
+    std::size_t size = 0;
+    typename lru_list_type::iterator lru_itr;
+  };
+
+  struct shard
+  {
+    shard();
+
+    std::mutex mutex;
+    lru_list_type lru_list;
+    std::unordered_map< std::string, cache_entry > module_map;
+    frequency_sketch sketch;
+    std::size_t bytes = 0;
+  };
+
+  shard& get_shard( std::size_t hash );
+
+  // Evicts the least recently used module of a locked shard
+  void evict( shard& s );
+
+  // Evicts modules across shards until the cache is within its budget, locking one shard at a time
+  void trim( const shard* keep = nullptr );
+
+  std::vector< std::unique_ptr< shard > > _shards;
+
+  std::atomic< std::size_t > _bytes     = 0;
+  std::atomic< std::size_t > _max_bytes = 0;
+  std::atomic< std::size_t > _next_trim = 0;
+
+  std::atomic< uint64_t > _hits       = 0;
+  std::atomic< uint64_t > _misses     = 0;
+  std::atomic< uint64_t > _evictions  = 0;
+  std::atomic< uint64_t > _rejections = 0;
 };
 
 } // namespace koinos::vm_manager::fizzy
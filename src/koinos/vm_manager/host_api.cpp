@@ -6,4 +6,9 @@ abstract_host_api::abstract_host_api() {}
 
 abstract_host_api::~abstract_host_api() {}
 
+bool abstract_host_api::exited() const
+{
+  return false;
+}
+
 } // namespace koinos::vm_manager
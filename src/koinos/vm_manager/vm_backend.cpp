@@ -12,6 +12,20 @@ vm_backend::vm_backend() {}
 
 vm_backend::~vm_backend() {}
 
+void vm_backend::run_cached( abstract_host_api& hapi, const std::string& id, const bytecode_loader& load )
+{
+  run( hapi, load(), id );
+}
+
+void vm_backend::prewarm( const std::string& id, const std::string& bytecode ) {}
+
+void vm_backend::set_module_cache_size( std::size_t bytes ) {}
+
+module_cache_stats vm_backend::get_module_cache_stats() const
+{
+  return module_cache_stats();
+}
+
 std::vector< std::shared_ptr< vm_backend > > get_vm_backends()
 {
   std::vector< std::shared_ptr< vm_backend > > result;
@@ -2,12 +2,25 @@
 
 #include <koinos/vm_manager/host_api.hpp>
 
+#include <functional>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace koinos::vm_manager {
 
+struct module_cache_stats
+{
+  uint64_t hits       = 0;
+  uint64_t misses     = 0;
+  uint64_t evictions  = 0;
+  uint64_t rejections = 0;
+  uint64_t bytes      = 0;
+  uint64_t modules    = 0;
+};
+
 /**
  * Abstract class for WebAssembly virtual machines.
  *
@@ -17,6 +30,8 @@ namespace koinos::vm_manager {
 class vm_backend
 {
    public:
+      using bytecode_loader = std::function< const std::string&() >;
+
       vm_backend();
       virtual ~vm_backend();
 
@@ -31,6 +46,23 @@ class vm_backend
        * Run some bytecode.
        */
       virtual void run( abstract_host_api& hapi, const std::string& bytecode, const std::string& id = std::string() ) = 0;
+
+      /**
+       * Run the module cached under id, only calling load for its bytecode when it is not cached.
+       */
+      virtual void run_cached( abstract_host_api& hapi, const std::string& id, const bytecode_loader& load );
+
+      /**
+       * Parse bytecode into the module cache under id ahead of it being run, if it is not cached already.
+       */
+      virtual void prewarm( const std::string& id, const std::string& bytecode );
+
+      /**
+       * Bound the memory used by cached modules, as bytes of the bytecode they were parsed from.
+       */
+      virtual void set_module_cache_size( std::size_t bytes );
+
+      virtual module_cache_stats get_module_cache_stats() const;
 };
 
 /**
@@ -13,6 +13,9 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/delimited_message_util.h>
 #include <google/protobuf/util/json_util.h>
 
 #include <koinos/chain/constants.hpp>
@@ -37,6 +40,8 @@
 
 #include "git_version.h"
 
+#define CHAIN_BATCH_SERVICE "chain_batch"
+
 #define FIFO_ALGORITHM       "fifo"
 #define BLOCK_TIME_ALGORITHM "block-time"
 #define POB_ALGORITHM        "pob"
@@ -74,6 +79,14 @@
 #define PENDING_TRANSACTION_LIMIT_DEFAULT         10
 #define VERIFY_BLOCKS_OPTION                      "verify-blocks"
 #define VERIFY_BLOCKS_DEFAULT                     false
+#define VERIFICATION_JOBS_OPTION                  "verification-jobs"
+#define VERIFICATION_JOBS_DEFAULT                 uint64_t( 0 )
+#define PARALLEL_TRANSACTIONS_OPTION              "parallel-transactions"
+#define PARALLEL_TRANSACTIONS_DEFAULT             false
+#define BATCH_EVENTS_OPTION                       "batch-events"
+#define BATCH_EVENTS_DEFAULT                      false
+#define MODULE_CACHE_SIZE_OPTION                  "module-cache-size"
+#define MODULE_CACHE_SIZE_DEFAULT                 uint64_t( 32 )
 
 KOINOS_DECLARE_EXCEPTION( service_exception );
 KOINOS_DECLARE_DERIVED_EXCEPTION( invalid_argument, service_exception );
@@ -82,16 +95,20 @@ using namespace boost;
 using namespace koinos;
 
 const std::string& version_string();
+rpc::chain::chain_response handle_request( chain::controller& controller, const rpc::chain::chain_request& args );
+rpc::chain::chain_response bad_message_response();
+bool is_read_request( const rpc::chain::chain_request& args );
 void attach_request_handler( chain::controller& controller, mq::request_handler& reqhandler );
 
 int main( int argc, char** argv )
 {
   std::string amqp_url, log_level, log_dir, instance_id, fork_algorithm_option;
   std::filesystem::path statedir, genesis_data_file;
-  uint64_t jobs, read_compute_limit, pending_transaction_limit;
+  uint64_t jobs, read_compute_limit, pending_transaction_limit, verification_jobs, module_cache_size;
   uint32_t syscall_bufsize;
   chain::genesis_data genesis_data;
-  bool reset, log_color, log_datetime, disable_pending_transaction_limit, verify_blocks;
+  bool reset, log_color, log_datetime, disable_pending_transaction_limit, verify_blocks, parallel_transactions,
+    batch_events;
   chain::fork_resolution_algorithm fork_algorithm;
 
   try
@@ -118,7 +135,11 @@ int main( int argc, char** argv )
       ( SYSTEM_CALL_BUFFER_SIZE_OPTION          , program_options::value< uint32_t >()   , "System call RPC invocation buffer size" )
       ( DISABLE_PENDING_TRANSACTION_LIMIT_OPTION, program_options::value< bool >()       , "Disable the pending transaction limit")
       ( PENDING_TRANSACTION_LIMIT_OPTION        , program_options::value< uint64_t >()   , "Pending transaction limit per address (Default: 10)" )
-      ( VERIFY_BLOCKS_OPTION                    , program_options::value< bool >()       , "Verify block receipts on reindex" );
+      ( VERIFY_BLOCKS_OPTION                    , program_options::value< bool >()       , "Verify block receipts on reindex" )
+      ( VERIFICATION_JOBS_OPTION                , program_options::value< uint64_t >()   , "The number of threads used to pre-validate blocks, 0 to disable" )
+      ( PARALLEL_TRANSACTIONS_OPTION            , program_options::value< bool >()       , "Speculatively apply block transactions in parallel on the verification threads" )
+      ( BATCH_EVENTS_OPTION                     , program_options::value< bool >()       , "Additionally broadcast the events of each block as a single koinos.block.events message of length delimited event parcels" )
+      ( MODULE_CACHE_SIZE_OPTION                , program_options::value< uint64_t >()   , "The size of the contract module cache in MiB of bytecode (Default: 32)" );
     // clang-format on
 
     program_options::variables_map args;
@@ -176,6 +197,10 @@ int main( int argc, char** argv )
     disable_pending_transaction_limit = util::get_option< bool >( DISABLE_PENDING_TRANSACTION_LIMIT_OPTION, DISABLE_PENDING_TRANSACTION_LIMIT_DEFAULT, args, chain_config, global_config );
     pending_transaction_limit         = util::get_option< uint64_t >( PENDING_TRANSACTION_LIMIT_OPTION, PENDING_TRANSACTION_LIMIT_DEFAULT, args, chain_config, global_config );
     verify_blocks                     = util::get_option< bool >( VERIFY_BLOCKS_OPTION, VERIFY_BLOCKS_DEFAULT, args, chain_config, global_config );
+    verification_jobs                 = util::get_option< uint64_t >( VERIFICATION_JOBS_OPTION, VERIFICATION_JOBS_DEFAULT, args, chain_config, global_config );
+    parallel_transactions             = util::get_option< bool >( PARALLEL_TRANSACTIONS_OPTION, PARALLEL_TRANSACTIONS_DEFAULT, args, chain_config, global_config );
+    batch_events                      = util::get_option< bool >( BATCH_EVENTS_OPTION, BATCH_EVENTS_DEFAULT, args, chain_config, global_config );
+    module_cache_size                 = util::get_option< uint64_t >( MODULE_CACHE_SIZE_OPTION, MODULE_CACHE_SIZE_DEFAULT, args, chain_config, global_config );
     // clang-format on
 
     std::optional< std::filesystem::path > logdir_path;
@@ -262,7 +287,11 @@ int main( int argc, char** argv )
   chain::controller controller( read_compute_limit,
                                 syscall_bufsize,
                                 disable_pending_transaction_limit ? std::optional< uint64_t >()
-                                                                  : pending_transaction_limit );
+                                                                  : pending_transaction_limit,
+                                verification_jobs,
+                                parallel_transactions,
+                                batch_events,
+                                module_cache_size * 1'024 * 1'024 );
 
   try
   {
@@ -356,6 +385,14 @@ int main( int argc, char** argv )
 
   controller.close();
 
+  auto module_stats = controller.get_module_cache_stats();
+  LOG( info ) << "Module cache: " << module_stats.hits << " hits, " << module_stats.misses << " misses, "
+              << module_stats.evictions << " evictions, " << module_stats.rejections << " rejections";
+
+  auto block_store_stats = controller.get_block_store_stats();
+  LOG( info ) << "Block store: " << block_store_stats.stored << " blocks stored, " << block_store_stats.failures
+              << " failed submissions, " << block_store_stats.dropped << " blocks dropped";
+
   for( auto& t: threads )
     t.join();
 
@@ -373,150 +410,182 @@ const std::string& version_string()
   return v_str;
 }
 
-void attach_request_handler( chain::controller& controller, mq::request_handler& reqhandler )
+rpc::chain::chain_response handle_request( chain::controller& controller, const rpc::chain::chain_request& args )
 {
-  reqhandler.add_rpc_handler(
-    util::service::chain,
-    [ & ]( const std::string& msg ) -> std::string
+  rpc::chain::chain_response resp;
+
+  LOG( debug ) << "Received RPC: " << args;
+
+  try
+  {
+    switch( args.request_case() )
     {
-      rpc::chain::chain_request args;
-      rpc::chain::chain_response resp;
+      case rpc::chain::chain_request::RequestCase::kReserved:
+        resp.mutable_reserved();
+        break;
+      case rpc::chain::chain_request::RequestCase::kSubmitBlock:
+        *resp.mutable_submit_block() = controller.submit_block( args.submit_block() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kSubmitTransaction:
+        *resp.mutable_submit_transaction() = controller.submit_transaction( args.submit_transaction() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetHeadInfo:
+        *resp.mutable_get_head_info() = controller.get_head_info( args.get_head_info() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetChainId:
+        *resp.mutable_get_chain_id() = controller.get_chain_id( args.get_chain_id() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetForkHeads:
+        *resp.mutable_get_fork_heads() = controller.get_fork_heads( args.get_fork_heads() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kReadContract:
+        *resp.mutable_read_contract() = controller.read_contract( args.read_contract() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetAccountNonce:
+        *resp.mutable_get_account_nonce() = controller.get_account_nonce( args.get_account_nonce() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetAccountRc:
+        *resp.mutable_get_account_rc() = controller.get_account_rc( args.get_account_rc() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kGetResourceLimits:
+        *resp.mutable_get_resource_limits() = controller.get_resource_limits( args.get_resource_limits() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kInvokeSystemCall:
+        *resp.mutable_invoke_system_call() = controller.invoke_system_call( args.invoke_system_call() );
+        break;
+      case rpc::chain::chain_request::RequestCase::kProposeBlock:
+        *resp.mutable_propose_block() = controller.propose_block( args.propose_block() );
+        break;
+      default:
+        resp.mutable_error()->set_message( "Error: attempted to call unknown rpc" );
+        break;
+    }
+  }
+  catch( const koinos::exception& e )
+  {
+    auto error = resp.mutable_error();
+    error->set_message( e.what() );
 
-      if( args.ParseFromString( msg ) )
-      {
-        LOG( debug ) << "Received RPC: " << args;
-
-        try
-        {
-          switch( args.request_case() )
-          {
-            case rpc::chain::chain_request::RequestCase::kReserved:
-              resp.mutable_reserved();
-              break;
-            case rpc::chain::chain_request::RequestCase::kSubmitBlock:
-              *resp.mutable_submit_block() = controller.submit_block( args.submit_block() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kSubmitTransaction:
-              *resp.mutable_submit_transaction() = controller.submit_transaction( args.submit_transaction() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetHeadInfo:
-              *resp.mutable_get_head_info() = controller.get_head_info( args.get_head_info() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetChainId:
-              *resp.mutable_get_chain_id() = controller.get_chain_id( args.get_chain_id() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetForkHeads:
-              *resp.mutable_get_fork_heads() = controller.get_fork_heads( args.get_fork_heads() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kReadContract:
-              *resp.mutable_read_contract() = controller.read_contract( args.read_contract() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetAccountNonce:
-              *resp.mutable_get_account_nonce() = controller.get_account_nonce( args.get_account_nonce() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetAccountRc:
-              *resp.mutable_get_account_rc() = controller.get_account_rc( args.get_account_rc() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kGetResourceLimits:
-              *resp.mutable_get_resource_limits() = controller.get_resource_limits( args.get_resource_limits() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kInvokeSystemCall:
-              *resp.mutable_invoke_system_call() = controller.invoke_system_call( args.invoke_system_call() );
-              break;
-            case rpc::chain::chain_request::RequestCase::kProposeBlock:
-              *resp.mutable_propose_block() = controller.propose_block( args.propose_block() );
-              break;
-            default:
-              resp.mutable_error()->set_message( "Error: attempted to call unknown rpc" );
-              break;
-          }
-        }
-        catch( const koinos::exception& e )
-        {
-          auto error = resp.mutable_error();
-          error->set_message( e.what() );
-
-          auto j      = e.get_json();
-          j[ "code" ] = e.get_code();
+    auto j      = e.get_json();
+    j[ "code" ] = e.get_code();
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
-          error->set_data( j.dump() );
+    error->set_data( j.dump() );
 #pragma GCC diagnostic pop
 #pragma clang diagnostic pop
 
-          chain::error_details details;
-          details.set_code( e.get_code() );
+    chain::error_details details;
+    details.set_code( e.get_code() );
 
-          if( const auto& logs = j[ "logs" ]; logs.is_array() )
-            for( const auto& line: logs )
-              details.add_logs( line.get< std::string >() );
+    if( const auto& logs = j[ "logs" ]; logs.is_array() )
+      for( const auto& line: logs )
+        details.add_logs( line.get< std::string >() );
 
-          error->add_details()->PackFrom( details );
-        }
-        catch( std::exception& e )
-        {
-          auto error = resp.mutable_error();
-          error->set_message( e.what() );
+    error->add_details()->PackFrom( details );
+  }
+  catch( std::exception& e )
+  {
+    auto error = resp.mutable_error();
+    error->set_message( e.what() );
 
-          nlohmann::json j;
-          j[ "code" ] = chain::internal_error;
+    nlohmann::json j;
+    j[ "code" ] = chain::internal_error;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
-          error->set_data( j.dump() );
+    error->set_data( j.dump() );
 #pragma GCC diagnostic pop
 #pragma clang diagnostic pop
 
-          chain::error_details details;
-          details.set_code( chain::internal_error );
-          error->add_details()->PackFrom( details );
-        }
-        catch( ... )
-        {
-          LOG( error ) << "Unexpected error while handling rpc: " << args.ShortDebugString();
+    chain::error_details details;
+    details.set_code( chain::internal_error );
+    error->add_details()->PackFrom( details );
+  }
+  catch( ... )
+  {
+    LOG( error ) << "Unexpected error while handling rpc: " << args.ShortDebugString();
 
-          auto error = resp.mutable_error();
-          error->set_message( "unexpected error while handling rpc" );
+    auto error = resp.mutable_error();
+    error->set_message( "unexpected error while handling rpc" );
 
-          nlohmann::json j;
-          j[ "code" ] = chain::internal_error;
+    nlohmann::json j;
+    j[ "code" ] = chain::internal_error;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
-          error->set_data( j.dump() );
+    error->set_data( j.dump() );
 #pragma GCC diagnostic pop
 #pragma clang diagnostic pop
 
-          chain::error_details details;
-          details.set_code( chain::internal_error );
-          error->add_details()->PackFrom( details );
-        }
-      }
-      else
-      {
-        LOG( warning ) << "Received bad message";
+    chain::error_details details;
+    details.set_code( chain::internal_error );
+    error->add_details()->PackFrom( details );
+  }
 
-        auto error = resp.mutable_error();
-        error->set_message( "received bad message" );
+  return resp;
+}
 
-        nlohmann::json j;
-        j[ "code" ] = chain::internal_error;
+rpc::chain::chain_response bad_message_response()
+{
+  rpc::chain::chain_response resp;
+
+  LOG( warning ) << "Received bad message";
+
+  auto error = resp.mutable_error();
+  error->set_message( "received bad message" );
+
+  nlohmann::json j;
+  j[ "code" ] = chain::internal_error;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
-        error->set_data( j.dump() );
+  error->set_data( j.dump() );
 #pragma GCC diagnostic pop
 #pragma clang diagnostic pop
 
-        chain::error_details details;
-        details.set_code( chain::internal_error );
-        error->add_details()->PackFrom( details );
-      }
+  chain::error_details details;
+  details.set_code( chain::internal_error );
+  error->add_details()->PackFrom( details );
+
+  return resp;
+}
+
+bool is_read_request( const rpc::chain::chain_request& args )
+{
+  switch( args.request_case() )
+  {
+    case rpc::chain::chain_request::RequestCase::kGetHeadInfo:
+    case rpc::chain::chain_request::RequestCase::kGetChainId:
+    case rpc::chain::chain_request::RequestCase::kGetForkHeads:
+    case rpc::chain::chain_request::RequestCase::kReadContract:
+    case rpc::chain::chain_request::RequestCase::kGetAccountNonce:
+    case rpc::chain::chain_request::RequestCase::kGetAccountRc:
+    case rpc::chain::chain_request::RequestCase::kGetResourceLimits:
+    case rpc::chain::chain_request::RequestCase::kInvokeSystemCall:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void attach_request_handler( chain::controller& controller, mq::request_handler& reqhandler )
+{
+  reqhandler.add_rpc_handler(
+    util::service::chain,
+    [ & ]( const std::string& msg ) -> std::string
+    {
+      rpc::chain::chain_request args;
+      rpc::chain::chain_response resp;
+
+      if( args.ParseFromString( msg ) )
+        resp = handle_request( controller, args );
+      else
+        resp = bad_message_response();
 
       LOG( debug ) << "Sending RPC response: " << resp;
 
@@ -525,6 +594,55 @@ void attach_request_handler( chain::controller& controller, mq::request_handler&
       return r;
     } );
 
+  // A batch is a sequence of length delimited read requests, executed against the same head and
+  // answered with a sequence of length delimited responses in the same order
+  reqhandler.add_rpc_handler(
+    CHAIN_BATCH_SERVICE,
+    [ & ]( const std::string& msg ) -> std::string
+    {
+      std::vector< rpc::chain::chain_request > requests;
+
+      {
+        google::protobuf::io::ArrayInputStream input( msg.data(), int( msg.size() ) );
+        google::protobuf::io::CodedInputStream coded_input( &input );
+        bool clean_eof = false;
+
+        for( rpc::chain::chain_request args;
+             google::protobuf::util::ParseDelimitedFromCodedStream( &args, &coded_input, &clean_eof ); )
+          requests.emplace_back( std::move( args ) );
+
+        if( !clean_eof )
+          requests.clear();
+      }
+
+      std::string r;
+      google::protobuf::io::StringOutputStream output( &r );
+
+      if( requests.empty() )
+      {
+        google::protobuf::util::SerializeDelimitedToZeroCopyStream( bad_message_response(), &output );
+        return r;
+      }
+
+      LOG( debug ) << "Received RPC batch of " << requests.size() << " requests";
+
+      auto batch = controller.begin_read_batch();
+
+      for( const auto& args: requests )
+      {
+        rpc::chain::chain_response resp;
+
+        if( is_read_request( args ) )
+          resp = handle_request( controller, args );
+        else
+          resp.mutable_error()->set_message( "Error: attempted to call rpc that cannot be batched" );
+
+        google::protobuf::util::SerializeDelimitedToZeroCopyStream( resp, &output );
+      }
+
+      return r;
+    } );
+
   reqhandler.add_broadcast_handler( "koinos.block.accept",
                                     [ & ]( const std::string& msg )
                                     {
@@ -3,12 +3,24 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include <google/protobuf/util/message_differencer.h>
+
+#include <koinos/chain/block_store_writer.hpp>
+#include <koinos/chain/broadcast_publisher.hpp>
 #include <koinos/chain/constants.hpp>
 #include <koinos/chain/controller.hpp>
 #include <koinos/chain/exceptions.hpp>
 #include <koinos/chain/execution_context.hpp>
+#include <koinos/chain/module_prewarmer.hpp>
+#include <koinos/chain/parallel_executor.hpp>
+#include <koinos/chain/read_cache.hpp>
 #include <koinos/chain/state.hpp>
 #include <koinos/chain/system_calls.hpp>
+#include <koinos/chain/verification_memo.hpp>
+#include <koinos/chain/verified_transaction_cache.hpp>
+#include <koinos/chain/worker_pool.hpp>
 #include <koinos/crypto/elliptic.hpp>
 #include <koinos/crypto/multihash.hpp>
 #include <koinos/util/base58.hpp>
@@ -17,13 +29,21 @@
 #include <koinos/tests/contracts.hpp>
 #include <koinos/tests/util.hpp>
 
+#include <koinos/broadcast/broadcast.pb.h>
 #include <koinos/chain/chain.pb.h>
 #include <koinos/chain/system_calls.pb.h>
 #include <koinos/contracts/token/token.pb.h>
+#include <koinos/rpc/block_store/block_store_rpc.pb.h>
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <thread>
 
 using namespace koinos;
 using namespace std::string_literals;
@@ -506,6 +526,818 @@ BOOST_AUTO_TEST_CASE( propose_block )
   KOINOS_CATCH_LOG_AND_RETHROW( info )
 }
 
+BOOST_AUTO_TEST_CASE( block_prevalidation )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Building a block to pre-validate" );
+
+    protocol::block block;
+    block.mutable_header()->set_height( 1 );
+    block.mutable_header()->set_timestamp( 1 );
+    block.mutable_header()->set_previous(
+      util::converter::as< std::string >( crypto::multihash::zero( crypto::multicodec::sha2_256 ) ) );
+
+    for( uint64_t i = 0; i < 8; i++ )
+    {
+      auto* trx = block.add_transactions();
+
+      chain::value_type nonce_value;
+      nonce_value.set_uint64_value( i + 1 );
+      trx->mutable_header()->set_chain_id( _controller.get_chain_id().chain_id() );
+      trx->mutable_header()->set_rc_limit( 10'000'000 );
+      trx->mutable_header()->set_nonce( util::converter::as< std::string >( nonce_value ) );
+
+      auto* op = trx->add_operations()->mutable_call_contract();
+      op->set_contract_id( _alice_address );
+      op->set_entry_point( uint32_t( i ) );
+
+      set_transaction_merkle_roots( *trx, crypto::multicodec::sha2_256 );
+      sign_transaction( *trx, _alice_private_key );
+    }
+
+    // Give the last transaction a second, invalid signature
+    block.mutable_transactions( 7 )->add_signatures( std::string( 65, '\0' ) );
+
+    set_block_merkle_roots( block, crypto::multicodec::sha2_256 );
+    sign_block( block, _block_signing_private_key );
+
+    chain::worker_pool pool( 4 );
+    auto memo = chain::prevalidate_block( pool, block, crypto::multicodec::sha2_256 );
+    BOOST_REQUIRE( memo );
+
+    const auto sha2_256 = std::underlying_type_t< crypto::multicodec >( crypto::multicodec::sha2_256 );
+
+    BOOST_TEST_MESSAGE( "Checking the block header" );
+
+    auto header      = util::converter::as< std::string >( block.header() );
+    auto header_hash = util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, header ) );
+
+    const auto* digest = memo->find_hash( sha2_256, header, 0 );
+    BOOST_REQUIRE( digest );
+    BOOST_CHECK_EQUAL( *digest, header_hash );
+    BOOST_CHECK( !memo->find_hash( sha2_256, header, 32 ) );
+
+    const auto* signer = memo->find_public_key( block.signature(), header_hash );
+    BOOST_REQUIRE( signer );
+    BOOST_CHECK_EQUAL( *signer, util::converter::as< std::string >( _block_signing_private_key.get_public_key() ) );
+
+    BOOST_TEST_MESSAGE( "Checking the transactions" );
+
+    std::vector< std::string > leaves;
+
+    for( const auto& trx: block.transactions() )
+    {
+      leaves.emplace_back(
+        util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, trx.header() ) ) );
+      leaves.emplace_back(
+        util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, trx.signatures() ) ) );
+
+      digest = memo->find_hash( sha2_256, util::converter::as< std::string >( trx.header() ), 0 );
+      BOOST_REQUIRE( digest );
+      BOOST_CHECK_EQUAL( *digest, leaves[ leaves.size() - 2 ] );
+
+      std::vector< std::string > op_hashes;
+      for( const auto& op: trx.operations() )
+      {
+        auto op_bytes = util::converter::as< std::string >( op );
+        op_hashes.emplace_back(
+          util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, op_bytes ) ) );
+
+        digest = memo->find_hash( sha2_256, op_bytes, 0 );
+        BOOST_REQUIRE( digest );
+        BOOST_CHECK_EQUAL( *digest, op_hashes.back() );
+      }
+
+      auto op_root_matches = memo->find_merkle_root( trx.header().operation_merkle_root(), op_hashes );
+      BOOST_REQUIRE( op_root_matches );
+      BOOST_CHECK( *op_root_matches );
+
+      signer = memo->find_public_key( trx.signatures( 0 ), trx.id() );
+      BOOST_REQUIRE( signer );
+      BOOST_CHECK_EQUAL( *signer, util::converter::as< std::string >( _alice_private_key.get_public_key() ) );
+    }
+
+    BOOST_CHECK( !memo->find_public_key( block.transactions( 7 ).signatures( 1 ), block.transactions( 7 ).id() ) );
+
+    auto trx_root_matches = memo->find_merkle_root( block.header().transaction_merkle_root(), leaves );
+    BOOST_REQUIRE( trx_root_matches );
+    BOOST_CHECK( *trx_root_matches );
+
+    leaves.pop_back();
+    BOOST_CHECK( !memo->find_merkle_root( block.header().transaction_merkle_root(), leaves ) );
+
+    BOOST_TEST_MESSAGE( "Checking verified transactions are reused" );
+
+    chain::verified_transaction_cache cache( 4 );
+    for( int i = 0; i < 4; i++ )
+      cache.add( block.transactions( i ),
+                 chain::verify_transaction( block.transactions( i ), crypto::multicodec::sha2_256 ) );
+
+    BOOST_CHECK_EQUAL( cache.size(), 4 );
+    BOOST_CHECK( cache.find( block.transactions( 0 ), crypto::multicodec::sha2_256 ) );
+    BOOST_CHECK( !cache.find( block.transactions( 0 ), crypto::multicodec::sha2_512 ) );
+
+    auto forged = block.transactions( 0 );
+    forged.set_signatures( 0, block.transactions( 1 ).signatures( 0 ) );
+    BOOST_CHECK( !cache.find( forged, crypto::multicodec::sha2_256 ) );
+
+    auto recalled = chain::recall_block( block, crypto::multicodec::sha2_256, cache );
+    BOOST_REQUIRE( recalled );
+    BOOST_CHECK( recalled->find_public_key( block.transactions( 0 ).signatures( 0 ), block.transactions( 0 ).id() ) );
+    BOOST_CHECK( !recalled->find_public_key( block.transactions( 4 ).signatures( 0 ), block.transactions( 4 ).id() ) );
+    BOOST_CHECK( !recalled->find_merkle_root( block.header().transaction_merkle_root(), leaves ) );
+
+    auto hits   = cache.hits();
+    auto cached = chain::prevalidate_block( pool, block, crypto::multicodec::sha2_256, &cache );
+    BOOST_REQUIRE( cached );
+    BOOST_CHECK_EQUAL( cache.hits(), hits + 4 );
+    BOOST_CHECK_EQUAL( cached->size(), memo->size() );
+
+    BOOST_TEST_MESSAGE( "Applying a block with and without pre-validation" );
+
+    auto pooled_state_dir = std::filesystem::temp_directory_path() / boost::filesystem::unique_path().string();
+    std::filesystem::create_directory( pooled_state_dir );
+
+    chain::controller pooled_controller( 10'000'000, 64'000, {}, 2 );
+    pooled_controller.open( pooled_state_dir, _genesis_data, chain::fork_resolution_algorithm::fifo, false );
+
+    rpc::chain::submit_block_request block_req;
+    auto* upload_block = block_req.mutable_block();
+
+    auto duration = std::chrono::system_clock::now().time_since_epoch();
+    upload_block->mutable_header()->set_timestamp(
+      std::chrono::duration_cast< std::chrono::milliseconds >( duration ).count() );
+    upload_block->mutable_header()->set_height( 1 );
+    upload_block->mutable_header()->set_previous(
+      util::converter::as< std::string >( crypto::multihash::zero( crypto::multicodec::sha2_256 ) ) );
+    upload_block->mutable_header()->set_previous_state_merkle_root(
+      _controller.get_head_info().head_state_merkle_root() );
+
+    auto* trx = upload_block->add_transactions();
+
+    chain::value_type nonce_value;
+    nonce_value.set_uint64_value( 1 );
+    trx->mutable_header()->set_chain_id( _controller.get_chain_id().chain_id() );
+    trx->mutable_header()->set_rc_limit( 10'000'000 );
+    trx->mutable_header()->set_nonce( util::converter::as< std::string >( nonce_value ) );
+
+    auto* op = trx->add_operations()->mutable_upload_contract();
+    op->set_contract_id( _alice_address );
+    op->set_bytecode( get_hello_wasm() );
+
+    set_transaction_merkle_roots( *trx, crypto::multicodec::sha2_256 );
+    sign_transaction( *trx, _alice_private_key );
+
+    set_block_merkle_roots( *upload_block, crypto::multicodec::sha2_256 );
+    upload_block->set_id(
+      util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, upload_block->header() ) ) );
+    sign_block( *upload_block, _block_signing_private_key );
+
+    auto serial_resp = _controller.submit_block( block_req );
+    auto pooled_resp = pooled_controller.submit_block( block_req );
+
+    BOOST_REQUIRE( serial_resp.has_receipt() );
+    BOOST_REQUIRE( pooled_resp.has_receipt() );
+    BOOST_CHECK( google::protobuf::util::MessageDifferencer::Equals( serial_resp.receipt(), pooled_resp.receipt() ) );
+
+    pooled_controller.close();
+    std::filesystem::remove_all( pooled_state_dir );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( parallel_transaction_application )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Opening a controller that applies transactions in parallel" );
+
+    auto parallel_state_dir = std::filesystem::temp_directory_path() / boost::filesystem::unique_path().string();
+    std::filesystem::create_directory( parallel_state_dir );
+
+    chain::controller parallel_controller( 10'000'000, 64'000, {}, 4, true );
+    parallel_controller.open( parallel_state_dir, _genesis_data, chain::fork_resolution_algorithm::fifo, false );
+
+    BOOST_TEST_MESSAGE( "Building a block of independent and dependent transactions" );
+
+    rpc::chain::submit_block_request block_req;
+    auto* block = block_req.mutable_block();
+
+    auto duration = std::chrono::system_clock::now().time_since_epoch();
+    block->mutable_header()->set_timestamp(
+      std::chrono::duration_cast< std::chrono::milliseconds >( duration ).count() );
+    block->mutable_header()->set_height( 1 );
+    block->mutable_header()->set_previous(
+      util::converter::as< std::string >( crypto::multihash::zero( crypto::multicodec::sha2_256 ) ) );
+    block->mutable_header()->set_previous_state_merkle_root( _controller.get_head_info().head_state_merkle_root() );
+
+    std::vector< crypto::private_key > keys;
+    for( int i = 0; i < 6; i++ )
+      keys.emplace_back( crypto::private_key::regenerate(
+        crypto::hash( crypto::multicodec::sha2_256, "parallel" + std::to_string( i ) ) ) );
+
+    // Independent contract uploads from distinct payers, the last two also emit an event each
+    for( int i = 0; i < 6; i++ )
+    {
+      auto* trx = block->add_transactions();
+
+      chain::value_type nonce_value;
+      nonce_value.set_uint64_value( 1 );
+      trx->mutable_header()->set_chain_id( _controller.get_chain_id().chain_id() );
+      trx->mutable_header()->set_rc_limit( 10'000'000 );
+      trx->mutable_header()->set_nonce( util::converter::as< std::string >( nonce_value ) );
+
+      auto* op = trx->add_operations()->mutable_upload_contract();
+      op->set_contract_id( util::converter::as< std::string >( keys[ i ].get_public_key().to_address_bytes() ) );
+      op->set_bytecode( get_hello_wasm() );
+
+      if( i >= 4 )
+      {
+        auto* sys_op = trx->add_operations()->mutable_set_system_contract();
+        sys_op->set_contract_id( op->contract_id() );
+        sys_op->set_system_contract( true );
+      }
+
+      set_transaction_merkle_roots( *trx, crypto::multicodec::sha2_256 );
+      sign_transaction( *trx, keys[ i ] );
+
+      if( i >= 4 )
+        add_signature( *trx, _block_signing_private_key );
+    }
+
+    // Sequential nonces from the same payer depend on each other
+    for( uint64_t nonce = 1; nonce <= 2; nonce++ )
+    {
+      auto* trx = block->add_transactions();
+
+      chain::value_type nonce_value;
+      nonce_value.set_uint64_value( nonce );
+      trx->mutable_header()->set_chain_id( _controller.get_chain_id().chain_id() );
+      trx->mutable_header()->set_rc_limit( 10'000'000 );
+      trx->mutable_header()->set_nonce( util::converter::as< std::string >( nonce_value ) );
+
+      auto* op = trx->add_operations()->mutable_upload_contract();
+      op->set_contract_id( _alice_address );
+      op->set_bytecode( nonce == 1 ? get_hello_wasm() : get_empty_contract_wasm() );
+
+      set_transaction_merkle_roots( *trx, crypto::multicodec::sha2_256 );
+      sign_transaction( *trx, _alice_private_key );
+    }
+
+    set_block_merkle_roots( *block, crypto::multicodec::sha2_256 );
+    block->set_id(
+      util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, block->header() ) ) );
+    sign_block( *block, _block_signing_private_key );
+
+    BOOST_TEST_MESSAGE( "Applying the block serially and in parallel" );
+
+    auto stats         = chain::parallel_executor::stats();
+    auto serial_resp   = _controller.submit_block( block_req );
+    auto parallel_resp = parallel_controller.submit_block( block_req );
+
+    BOOST_REQUIRE( serial_resp.has_receipt() );
+    BOOST_REQUIRE( parallel_resp.has_receipt() );
+    BOOST_REQUIRE_EQUAL( serial_resp.receipt().transaction_receipts_size(), 8 );
+    BOOST_REQUIRE_EQUAL( serial_resp.receipt().events_size(), 2 );
+
+    BOOST_TEST_MESSAGE( "Verifying independent transactions committed speculatively and the nonce chain did not" );
+
+    // The second transaction from alice uses a nonce that is only valid after the first
+    BOOST_CHECK_EQUAL( chain::parallel_executor::stats().committed - stats.committed, 7 );
+    BOOST_CHECK_EQUAL( chain::parallel_executor::stats().fallbacks - stats.fallbacks, 1 );
+
+    BOOST_TEST_MESSAGE( "Verifying the receipts and resulting state are identical" );
+
+    BOOST_CHECK( google::protobuf::util::MessageDifferencer::Equals( serial_resp.receipt(), parallel_resp.receipt() ) );
+    BOOST_CHECK_EQUAL( util::to_hex( _controller.get_head_info().head_state_merkle_root() ),
+                       util::to_hex( parallel_controller.get_head_info().head_state_merkle_root() ) );
+
+    BOOST_TEST_MESSAGE( "Calling the uploaded contracts serially and in parallel" );
+
+    rpc::chain::submit_block_request call_block_req;
+    auto* call_block = call_block_req.mutable_block();
+
+    call_block->mutable_header()->set_timestamp( block->header().timestamp() + 1 );
+    call_block->mutable_header()->set_height( 2 );
+    call_block->mutable_header()->set_previous( block->id() );
+    call_block->mutable_header()->set_previous_state_merkle_root(
+      _controller.get_head_info().head_state_merkle_root() );
+
+    for( int i = 0; i < 4; i++ )
+    {
+      auto* trx = call_block->add_transactions();
+
+      chain::value_type nonce_value;
+      nonce_value.set_uint64_value( 2 );
+      trx->mutable_header()->set_chain_id( _controller.get_chain_id().chain_id() );
+      trx->mutable_header()->set_rc_limit( 10'000'000 );
+      trx->mutable_header()->set_nonce( util::converter::as< std::string >( nonce_value ) );
+
+      auto* op = trx->add_operations()->mutable_call_contract();
+      op->set_contract_id( util::converter::as< std::string >( keys[ i ].get_public_key().to_address_bytes() ) );
+
+      set_transaction_merkle_roots( *trx, crypto::multicodec::sha2_256 );
+      sign_transaction( *trx, keys[ i ] );
+    }
+
+    set_block_merkle_roots( *call_block, crypto::multicodec::sha2_256 );
+    call_block->set_id(
+      util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, call_block->header() ) ) );
+    sign_block( *call_block, _block_signing_private_key );
+
+    stats         = chain::parallel_executor::stats();
+    serial_resp   = _controller.submit_block( call_block_req );
+    parallel_resp = parallel_controller.submit_block( call_block_req );
+
+    BOOST_REQUIRE( serial_resp.has_receipt() );
+    BOOST_REQUIRE( parallel_resp.has_receipt() );
+    BOOST_REQUIRE_EQUAL( serial_resp.receipt().transaction_receipts_size(), 4 );
+    BOOST_REQUIRE_EQUAL( serial_resp.receipt().transaction_receipts( 3 ).logs( 0 ), "Greetings from koinos vm" );
+
+    BOOST_CHECK_EQUAL( chain::parallel_executor::stats().committed - stats.committed, 4 );
+    BOOST_CHECK_EQUAL( chain::parallel_executor::stats().fallbacks - stats.fallbacks, 0 );
+
+    BOOST_CHECK( google::protobuf::util::MessageDifferencer::Equals( serial_resp.receipt(), parallel_resp.receipt() ) );
+    BOOST_CHECK_EQUAL( util::to_hex( _controller.get_head_info().head_state_merkle_root() ),
+                       util::to_hex( parallel_controller.get_head_info().head_state_merkle_root() ) );
+
+    parallel_controller.close();
+    std::filesystem::remove_all( parallel_state_dir );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( block_store_write_behind )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Creating a stand-in block store" );
+
+    static constexpr auto block_store_latency  = std::chrono::milliseconds( 5 );
+    static constexpr uint64_t num_blocks       = 32;
+    static constexpr std::size_t max_in_flight = 8;
+
+    std::mutex mutex;
+    std::vector< std::string > stored_ids;
+    std::string failing_id;
+    std::size_t failures_left   = 0;
+    std::size_t outstanding     = 0;
+    std::size_t max_outstanding = 0;
+
+    // Blocks are recorded in the order they are submitted, responses arrive after a fixed latency
+    auto block_store = [ & ]( const std::string& payload ) -> std::shared_future< std::string >
+    {
+      rpc::block_store::block_store_request req;
+      req.ParseFromString( payload );
+
+      rpc::block_store::block_store_response resp;
+
+      {
+        std::lock_guard< std::mutex > lock( mutex );
+        const auto& id = req.add_block().block_to_add().id();
+
+        if( id == failing_id && failures_left )
+        {
+          failures_left--;
+          resp.mutable_error()->set_message( "stand-in failure" );
+        }
+        else
+        {
+          stored_ids.push_back( id );
+          resp.mutable_add_block();
+        }
+
+        max_outstanding = std::max( max_outstanding, ++outstanding );
+      }
+
+      return std::async( std::launch::async,
+                         [ &, response = resp.SerializeAsString() ]()
+                         {
+                           std::this_thread::sleep_for( block_store_latency );
+
+                           std::lock_guard< std::mutex > lock( mutex );
+                           outstanding--;
+                           return response;
+                         } )
+        .share();
+    };
+
+    std::vector< protocol::block > blocks( num_blocks );
+    for( uint64_t i = 0; i < num_blocks; i++ )
+    {
+      blocks[ i ].mutable_header()->set_height( i + 1 );
+      blocks[ i ].set_id(
+        util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, blocks[ i ].header() ) ) );
+    }
+
+    BOOST_TEST_MESSAGE( "Storing blocks through the write-behind queue" );
+
+    {
+      chain::block_store_writer writer( block_store, max_in_flight );
+
+      for( const auto& block: blocks )
+      {
+        writer.add_block( block, protocol::block_receipt() );
+        BOOST_CHECK_LE( writer.in_flight(), max_in_flight );
+      }
+
+      writer.flush();
+
+      BOOST_CHECK_EQUAL( writer.in_flight(), 0 );
+      BOOST_CHECK_EQUAL( writer.stats().stored, num_blocks );
+      BOOST_CHECK_EQUAL( writer.stats().failures, 0 );
+
+      // Flushing waits for every response, and a block is only submitted once the previous one was stored
+      std::lock_guard< std::mutex > lock( mutex );
+      BOOST_CHECK_EQUAL( outstanding, 0 );
+      BOOST_CHECK_EQUAL( max_outstanding, 1 );
+      BOOST_REQUIRE_EQUAL( stored_ids.size(), num_blocks );
+    }
+
+    for( uint64_t i = 0; i < num_blocks; i++ )
+      BOOST_CHECK_EQUAL( stored_ids[ i ], blocks[ i ].id() );
+
+    BOOST_TEST_MESSAGE( "Retrying a failed block before the blocks behind it" );
+
+    stored_ids.clear();
+    failing_id    = blocks[ 1 ].id();
+    failures_left = 3;
+
+    {
+      chain::block_store_writer writer( block_store, max_in_flight, std::chrono::milliseconds( 1 ) );
+
+      for( std::size_t i = 0; i < 3; i++ )
+        writer.add_block( blocks[ i ], protocol::block_receipt() );
+
+      writer.flush();
+
+      BOOST_CHECK_EQUAL( writer.in_flight(), 0 );
+      BOOST_CHECK_EQUAL( writer.stats().stored, 3 );
+      BOOST_CHECK_EQUAL( writer.stats().failures, 3 );
+      BOOST_CHECK_EQUAL( writer.stats().dropped, 0 );
+    }
+
+    BOOST_REQUIRE_EQUAL( stored_ids.size(), 3 );
+    for( std::size_t i = 0; i < 3; i++ )
+      BOOST_CHECK_EQUAL( stored_ids[ i ], blocks[ i ].id() );
+
+    BOOST_TEST_MESSAGE( "Dropping blocks that still fail when the writer stops" );
+
+    stored_ids.clear();
+    failures_left = std::numeric_limits< std::size_t >::max();
+
+    {
+      chain::block_store_writer writer( block_store, max_in_flight, std::chrono::milliseconds( 1 ) );
+
+      for( std::size_t i = 0; i < 3; i++ )
+        writer.add_block( blocks[ i ], protocol::block_receipt() );
+
+      writer.stop();
+
+      BOOST_CHECK_EQUAL( writer.in_flight(), 0 );
+      BOOST_CHECK_EQUAL( writer.stats().stored, 1 );
+      BOOST_CHECK_GE( writer.stats().failures, 1 );
+      BOOST_CHECK_EQUAL( writer.stats().dropped, 2 );
+    }
+
+    BOOST_REQUIRE_EQUAL( stored_ids.size(), 1 );
+    BOOST_CHECK_EQUAL( stored_ids[ 0 ], blocks[ 0 ].id() );
+
+    BOOST_TEST_MESSAGE( "Draining queued blocks on destruction" );
+
+    stored_ids.clear();
+    failing_id.clear();
+    failures_left = 0;
+
+    {
+      chain::block_store_writer writer( block_store, max_in_flight );
+
+      for( const auto& block: blocks )
+        writer.add_block( block, protocol::block_receipt() );
+    }
+
+    BOOST_REQUIRE_EQUAL( stored_ids.size(), num_blocks );
+    for( uint64_t i = 0; i < num_blocks; i++ )
+      BOOST_CHECK_EQUAL( stored_ids[ i ], blocks[ i ].id() );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( broadcast_publisher_test )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Publishing a block with events" );
+
+    std::vector< std::pair< std::string, std::string > > published;
+
+    chain::block_publication publication;
+    publication.block.set_id( "block" );
+    publication.block.mutable_header()->set_height( 1 );
+    publication.receipt.set_id( "block" );
+    publication.receipt.set_height( 1 );
+    publication.live = true;
+    publication.head = true;
+    publication.last_irreversible_block.set_height( 0 );
+
+    for( uint32_t i = 0; i < 4; i++ )
+    {
+      protocol::event_data event;
+      event.set_sequence( i );
+      event.set_source( _alice_address );
+      event.set_name( "event" + std::to_string( i ) );
+
+      std::optional< std::string > transaction_id;
+      if( i > 0 )
+        transaction_id = i < 3 ? "trx1" : "trx2";
+
+      publication.events.emplace_back( transaction_id, std::move( event ) );
+    }
+
+    {
+      chain::broadcast_publisher publisher(
+        [ & ]( const std::string& topic, const std::string& payload )
+        {
+          published.emplace_back( topic, payload );
+        },
+        true );
+
+      publisher.publish_block( std::move( publication ) );
+      publisher.publish( "koinos.transaction.fail", "payload" );
+      publisher.flush();
+    }
+
+    BOOST_TEST_MESSAGE( "Verifying the published messages and their order" );
+
+    BOOST_REQUIRE_EQUAL( published.size(), 9 );
+    BOOST_CHECK_EQUAL( published[ 0 ].first, "koinos.block.irreversible" );
+    BOOST_CHECK_EQUAL( published[ 1 ].first, "koinos.block.accept" );
+    BOOST_CHECK_EQUAL( published[ 2 ].first, "koinos.block.forks" );
+
+    for( uint32_t i = 0; i < 4; i++ )
+    {
+      BOOST_CHECK_EQUAL( published[ 3 + i ].first,
+                         "koinos.event." + util::to_base58( _alice_address ) + ".event" + std::to_string( i ) );
+
+      broadcast::event_parcel ep;
+      BOOST_REQUIRE( ep.ParseFromString( published[ 3 + i ].second ) );
+      BOOST_CHECK_EQUAL( ep.event().sequence(), i );
+      BOOST_CHECK_EQUAL( ep.transaction_id().empty(), i == 0 );
+    }
+
+    BOOST_CHECK_EQUAL( published[ 7 ].first, "koinos.block.events" );
+
+    // The batch is the individual event parcels, each prefixed by its length
+    google::protobuf::io::ArrayInputStream batch_stream( published[ 7 ].second.data(),
+                                                         int( published[ 7 ].second.size() ) );
+
+    for( uint32_t i = 0; i < 4; i++ )
+    {
+      broadcast::event_parcel ep;
+      bool clean_eof = false;
+      BOOST_REQUIRE( google::protobuf::util::ParseDelimitedFromZeroCopyStream( &ep, &batch_stream, &clean_eof ) );
+      BOOST_CHECK_EQUAL( ep.SerializeAsString(), published[ 3 + i ].second );
+    }
+
+    broadcast::event_parcel trailing;
+    bool clean_eof = false;
+    BOOST_CHECK( !google::protobuf::util::ParseDelimitedFromZeroCopyStream( &trailing, &batch_stream, &clean_eof ) );
+    BOOST_CHECK( clean_eof );
+
+    BOOST_CHECK_EQUAL( published[ 8 ].first, "koinos.transaction.fail" );
+    BOOST_CHECK_EQUAL( published[ 8 ].second, "payload" );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( read_cache_test )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Checking read requests are memoized per head" );
+
+    rpc::chain::get_account_nonce_request nonce_req;
+    nonce_req.set_account( _alice_address );
+
+    auto stats = _controller.get_read_cache_stats();
+
+    auto chain_id = _controller.get_chain_id().chain_id();
+    auto nonce    = _controller.get_account_nonce( nonce_req ).nonce();
+
+    BOOST_CHECK_EQUAL( _controller.get_read_cache_stats().misses, stats.misses + 2 );
+    BOOST_CHECK_EQUAL( _controller.get_read_cache_stats().hits, stats.hits );
+
+    BOOST_CHECK_EQUAL( _controller.get_chain_id().chain_id(), chain_id );
+    BOOST_CHECK_EQUAL( _controller.get_account_nonce( nonce_req ).nonce(), nonce );
+
+    BOOST_CHECK_EQUAL( _controller.get_read_cache_stats().misses, stats.misses + 2 );
+    BOOST_CHECK_EQUAL( _controller.get_read_cache_stats().hits, stats.hits + 2 );
+
+    BOOST_TEST_MESSAGE( "Checking a new head invalidates the cache" );
+
+    rpc::chain::submit_block_request block_req;
+    block_req.mutable_block()->mutable_header()->set_timestamp( 1 );
+    block_req.mutable_block()->mutable_header()->set_height( 1 );
+    block_req.mutable_block()->mutable_header()->set_previous(
+      util::converter::as< std::string >( crypto::multihash::zero( crypto::multicodec::sha2_256 ) ) );
+    block_req.mutable_block()->mutable_header()->set_previous_state_merkle_root(
+      _controller.get_head_info().head_state_merkle_root() );
+    set_block_merkle_roots( *block_req.mutable_block(), crypto::multicodec::sha2_256 );
+    block_req.mutable_block()->set_id( util::converter::as< std::string >(
+      crypto::hash( crypto::multicodec::sha2_256, block_req.block().header() ) ) );
+    sign_block( *block_req.mutable_block(), _block_signing_private_key );
+
+    _controller.submit_block( block_req );
+
+    BOOST_CHECK_EQUAL( _controller.get_chain_id().chain_id(), chain_id );
+    BOOST_CHECK_EQUAL( _controller.get_read_cache_stats().misses, stats.misses + 3 );
+
+    BOOST_TEST_MESSAGE( "Checking per account entries are bounded" );
+
+    chain::read_cache cache( 2 );
+    cache.set_account_nonce( "alice", "1" );
+    cache.set_account_nonce( "bob", "2" );
+    BOOST_REQUIRE( cache.account_nonce( "alice" ) );
+    cache.set_account_rc( "charlie", 3 );
+
+    BOOST_CHECK( cache.account_nonce( "alice" ) );
+    BOOST_CHECK( !cache.account_nonce( "bob" ) );
+    BOOST_REQUIRE( cache.account_rc( "charlie" ) );
+    BOOST_CHECK_EQUAL( *cache.account_rc( "charlie" ), 3 );
+    BOOST_CHECK( !cache.account_rc( "alice" ) );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( module_prewarmer_test )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Checking modules are parsed into the module cache ahead of their first call" );
+
+    auto backend = vm_manager::get_vm_backend();
+    BOOST_REQUIRE( backend );
+    backend->initialize();
+
+    chain::module_prewarmer prewarmer( backend );
+    prewarmer.prewarm( "hello", get_hello_wasm() );
+    prewarmer.prewarm( "malformed", "not a module" );
+    prewarmer.flush();
+
+    auto stats = backend->get_module_cache_stats();
+    BOOST_CHECK_EQUAL( stats.modules, 1 );
+    BOOST_CHECK_EQUAL( stats.misses, 0 );
+
+    BOOST_TEST_MESSAGE( "Checking a module larger than an even share of the budget is cached" );
+
+    auto small_backend = vm_manager::get_vm_backend();
+    BOOST_REQUIRE( small_backend );
+    small_backend->initialize();
+    small_backend->set_module_cache_size( get_hello_wasm().size() );
+
+    small_backend->prewarm( "hello", get_hello_wasm() );
+    stats = small_backend->get_module_cache_stats();
+    BOOST_CHECK_EQUAL( stats.modules, 1 );
+    BOOST_CHECK_EQUAL( stats.bytes, get_hello_wasm().size() );
+    BOOST_CHECK_EQUAL( stats.rejections, 0 );
+
+    small_backend->prewarm( "hello_again", get_hello_wasm() );
+    stats = small_backend->get_module_cache_stats();
+    BOOST_CHECK_EQUAL( stats.modules, 1 );
+    BOOST_CHECK_EQUAL( stats.bytes, get_hello_wasm().size() );
+
+    BOOST_TEST_MESSAGE( "Checking the most called contracts are persisted" );
+
+    prewarmer.record_call( "alice" );
+    prewarmer.record_call( "bob" );
+    prewarmer.record_call( "bob" );
+    prewarmer.record_call( "charlie" );
+    prewarmer.record_call( "charlie" );
+    prewarmer.record_call( "charlie" );
+
+    auto hot_contracts = prewarmer.hottest( 2 );
+    BOOST_REQUIRE_EQUAL( hot_contracts.size(), 2 );
+    BOOST_CHECK_EQUAL( hot_contracts[ 0 ], "charlie" );
+    BOOST_CHECK_EQUAL( hot_contracts[ 1 ], "bob" );
+
+    auto path = _state_dir / "hot_contracts_test";
+    prewarmer.write_hot_contracts( path, 2 );
+    BOOST_CHECK( chain::module_prewarmer::read_hot_contracts( path ) == hot_contracts );
+    BOOST_CHECK( chain::module_prewarmer::read_hot_contracts( _state_dir / "missing" ).empty() );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( read_batch_test )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Checking reads in a batch execute against the same head" );
+
+    auto head_info = _controller.get_head_info();
+    auto chain_id  = _controller.get_chain_id().chain_id();
+
+    rpc::chain::get_account_nonce_request nonce_req;
+    nonce_req.set_account( _alice_address );
+
+    rpc::chain::submit_block_request block_req;
+    block_req.mutable_block()->mutable_header()->set_timestamp( 1 );
+    block_req.mutable_block()->mutable_header()->set_height( 1 );
+    block_req.mutable_block()->mutable_header()->set_previous( head_info.head_topology().id() );
+    block_req.mutable_block()->mutable_header()->set_previous_state_merkle_root(
+      head_info.head_state_merkle_root() );
+    set_block_merkle_roots( *block_req.mutable_block(), crypto::multicodec::sha2_256 );
+    block_req.mutable_block()->set_id( util::converter::as< std::string >(
+      crypto::hash( crypto::multicodec::sha2_256, block_req.block().header() ) ) );
+    sign_block( *block_req.mutable_block(), _block_signing_private_key );
+
+    {
+      auto batch = _controller.begin_read_batch();
+
+      _controller.submit_block( block_req );
+
+      BOOST_CHECK_EQUAL( _controller.get_head_info().head_topology().id(), head_info.head_topology().id() );
+      BOOST_CHECK_EQUAL( _controller.get_head_info().head_topology().height(), 0 );
+      BOOST_CHECK_EQUAL( _controller.get_chain_id().chain_id(), chain_id );
+      BOOST_CHECK_NO_THROW( _controller.get_account_nonce( nonce_req ) );
+      BOOST_CHECK_NO_THROW( _controller.get_resource_limits( {} ) );
+    }
+
+    BOOST_TEST_MESSAGE( "Checking reads after the batch see the new head" );
+
+    BOOST_CHECK_EQUAL( _controller.get_head_info().head_topology().id(), block_req.block().id() );
+    BOOST_CHECK_EQUAL( _controller.get_head_info().head_topology().height(), 1 );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( pinned_reads_defer_commits )
+{
+  try
+  {
+    auto submit_next_block = [ & ]()
+    {
+      auto head_info = _controller.get_head_info();
+
+      rpc::chain::submit_block_request block_req;
+      block_req.mutable_block()->mutable_header()->set_timestamp( head_info.head_block_time() + 1 );
+      block_req.mutable_block()->mutable_header()->set_height( head_info.head_topology().height() + 1 );
+      block_req.mutable_block()->mutable_header()->set_previous( head_info.head_topology().id() );
+      block_req.mutable_block()->mutable_header()->set_previous_state_merkle_root(
+        head_info.head_state_merkle_root() );
+      set_block_merkle_roots( *block_req.mutable_block(), crypto::multicodec::sha2_256 );
+      block_req.mutable_block()->set_id( util::converter::as< std::string >(
+        crypto::hash( crypto::multicodec::sha2_256, block_req.block().header() ) ) );
+      sign_block( *block_req.mutable_block(), _block_signing_private_key );
+
+      _controller.submit_block( block_req );
+    };
+
+    for( uint64_t i = 0; i < chain::default_irreversible_threshold; i++ )
+      submit_next_block();
+
+    BOOST_REQUIRE_EQUAL( _controller.get_fork_heads().last_irreversible_block().height(), 0 );
+
+    BOOST_TEST_MESSAGE( "Checking blocks apply while a reader is pinned and defer committing LIB" );
+
+    auto chain_id = _controller.get_chain_id().chain_id();
+
+    {
+      std::promise< void > pinned, released;
+      auto reader = std::async( std::launch::async,
+                                [ & ]()
+                                {
+                                  auto batch = _controller.begin_read_batch();
+                                  pinned.set_value();
+                                  released.get_future().wait();
+                                  return _controller.get_chain_id().chain_id();
+                                } );
+
+      pinned.get_future().wait();
+
+      for( uint64_t i = 0; i < 3; i++ )
+        submit_next_block();
+
+      BOOST_CHECK_EQUAL( _controller.get_head_info().head_topology().height(),
+                         chain::default_irreversible_threshold + 3 );
+      BOOST_CHECK_EQUAL( _controller.get_fork_heads().last_irreversible_block().height(), 0 );
+
+      BOOST_TEST_MESSAGE( "Checking the pinned reader still reads from its snapshot" );
+
+      released.set_value();
+      BOOST_CHECK_EQUAL( reader.get(), chain_id );
+    }
+
+    BOOST_TEST_MESSAGE( "Checking the deferred commit happens on the next block" );
+
+    submit_next_block();
+
+    BOOST_CHECK_EQUAL( _controller.get_fork_heads().last_irreversible_block().height(), 4 );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
 BOOST_AUTO_TEST_CASE( block_irreversibility )
 {
   try
@@ -699,6 +1531,8 @@ BOOST_AUTO_TEST_CASE( fork_heads )
     BOOST_CHECK_EQUAL( fork_heads.fork_heads( 0 ).height(), head_info.head_topology().height() );
     BOOST_CHECK_EQUAL( fork_heads.fork_heads( 0 ).previous(), head_info.head_topology().previous() );
     BOOST_CHECK_EQUAL( fork_heads.fork_heads( 0 ).id(), head_info.head_topology().id() );
+    BOOST_CHECK_EQUAL( fork_heads.last_irreversible_block().height(),
+                       _controller.get_head_info().last_irreversible_block() );
   }
   KOINOS_CATCH_LOG_AND_RETHROW( info )
 }
@@ -793,6 +1627,17 @@ BOOST_AUTO_TEST_CASE( read_contract_tests )
     response = _controller.read_contract( request );
     BOOST_REQUIRE_EQUAL( response.result(), "echo" );
 
+    BOOST_TEST_MESSAGE( "Test read contract reuses the cached module" );
+
+    auto module_stats = _controller.get_module_cache_stats();
+    BOOST_CHECK( module_stats.modules > 0 );
+    BOOST_CHECK( module_stats.bytes > 0 );
+
+    response = _controller.read_contract( request );
+    BOOST_REQUIRE_EQUAL( response.result(), "echo" );
+    BOOST_CHECK( _controller.get_module_cache_stats().hits > module_stats.hits );
+    BOOST_CHECK_EQUAL( _controller.get_module_cache_stats().misses, module_stats.misses );
+
     BOOST_TEST_MESSAGE( "Test read contract db write" );
 
     request.set_contract_id( util::converter::as< std::string >( key3.get_public_key().to_address_bytes() ) );
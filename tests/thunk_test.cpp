@@ -2,7 +2,9 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -394,6 +396,15 @@ BOOST_AUTO_TEST_CASE( get_transaction_field )
     KOINOS_REQUIRE_THROW( chain::system_call::get_transaction_field( ctx, "non_existent_field" ),
                           chain::field_not_found );
 
+    BOOST_TEST_MESSAGE( "Testing the descriptor pool is shared between contexts" );
+
+    koinos::chain::execution_context other_ctx( vm_backend, chain::intent::read_only );
+    other_ctx.set_state_node( ctx.get_state_node() );
+    BOOST_REQUIRE_EQUAL( &other_ctx.descriptor_pool(), &ctx.descriptor_pool() );
+
+    ctx.reset_cache();
+    BOOST_REQUIRE_EQUAL( &other_ctx.descriptor_pool(), &ctx.descriptor_pool() );
+
     ctx.clear_transaction();
 
     BOOST_TEST_MESSAGE( "Testing dynamic transaction field unexpected access" );
@@ -988,6 +999,79 @@ BOOST_AUTO_TEST_CASE( thunk_test )
   KOINOS_CATCH_LOG_AND_RETHROW( info )
 }
 
+BOOST_AUTO_TEST_CASE( thunk_argument_reuse )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Checking arguments parsed in to reused messages do not carry over between calls" );
+
+    const auto& dispatcher = chain::thunk_dispatcher::instance();
+
+    chain::object_space test_space;
+    test_space.set_system( true );
+    test_space.set_zone( chain::state::zone::kernel );
+    test_space.set_id( 100 );
+
+    char ret_buf[ 1'024 ];
+    uint32_t bytes_written = 0;
+
+    auto put_object = [ & ]( const std::string& key, const std::optional< std::string >& obj )
+    {
+      chain::put_object_arguments args;
+      *args.mutable_space() = test_space;
+      args.set_key( key );
+      if( obj )
+        args.set_obj( *obj );
+
+      auto arg = args.SerializeAsString();
+      dispatcher.call_thunk( static_cast< uint32_t >( chain::system_call_id::put_object ),
+                             ctx,
+                             ret_buf,
+                             sizeof( ret_buf ),
+                             arg.data(),
+                             uint32_t( arg.size() ),
+                             &bytes_written );
+    };
+
+    auto get_object = [ & ]( const std::string& key )
+    {
+      chain::get_object_arguments args;
+      *args.mutable_space() = test_space;
+      args.set_key( key );
+
+      auto arg = args.SerializeAsString();
+      dispatcher.call_thunk( static_cast< uint32_t >( chain::system_call_id::get_object ),
+                             ctx,
+                             ret_buf,
+                             sizeof( ret_buf ),
+                             arg.data(),
+                             uint32_t( arg.size() ),
+                             &bytes_written );
+
+      return util::converter::to< chain::get_object_result >( std::string( ret_buf, bytes_written ) ).value();
+    };
+
+    put_object( "key1", std::string( 512, 'a' ) );
+    put_object( "key2", "b"s );
+    put_object( "key3", std::nullopt );
+
+    auto obj = get_object( "key1" );
+    BOOST_REQUIRE( obj.exists() );
+    BOOST_CHECK_EQUAL( obj.value(), std::string( 512, 'a' ) );
+
+    obj = get_object( "key2" );
+    BOOST_REQUIRE( obj.exists() );
+    BOOST_CHECK_EQUAL( obj.value(), "b" );
+
+    obj = get_object( "key3" );
+    BOOST_REQUIRE( obj.exists() );
+    BOOST_CHECK( obj.value().empty() );
+
+    BOOST_CHECK( !get_object( "key4" ).exists() );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
 BOOST_AUTO_TEST_CASE( system_call_test )
 {
   try
@@ -1042,6 +1126,30 @@ BOOST_AUTO_TEST_CASE( get_head_info_thunk_test )
   KOINOS_CATCH_LOG_AND_RETHROW( info )
 }
 
+BOOST_AUTO_TEST_CASE( compute_registry_test )
+{
+  try
+  {
+    BOOST_TEST_MESSAGE( "Testing compute bandwidth lookups by thunk id and cost" );
+
+    BOOST_REQUIRE_EQUAL( ctx.get_thunk_compute_bandwidth( chain::system_call_id::get_head_info ),
+                         ctx.get_compute_bandwidth( "get_head_info" ) );
+    BOOST_REQUIRE_EQUAL( ctx.get_thunk_compute_bandwidth( chain::system_call_id::verify_vrf_proof ), 144'067 );
+    BOOST_REQUIRE_EQUAL( ctx.get_compute_bandwidth( chain::compute_cost::sha2_256_per_byte ),
+                         ctx.get_compute_bandwidth( "sha2_256_per_byte" ) );
+
+    KOINOS_REQUIRE_THROW( ctx.get_thunk_compute_bandwidth( std::numeric_limits< uint32_t >::max() ),
+                          chain::unknown_thunk_exception );
+
+    BOOST_TEST_MESSAGE( "Testing the compute registry is shared between contexts" );
+
+    koinos::chain::execution_context other_ctx( vm_backend, chain::intent::read_only );
+    other_ctx.set_state_node( ctx.get_state_node() );
+    BOOST_REQUIRE_EQUAL( &other_ctx.get_compute_registry(), &ctx.get_compute_registry() );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
 BOOST_AUTO_TEST_CASE( hash_thunk_test )
 {
   try
@@ -2020,6 +2128,103 @@ BOOST_AUTO_TEST_CASE( get_chain_id )
   BOOST_REQUIRE_EQUAL( chain_id_str, chain::system_call::get_chain_id( ctx ) );
 }
 
+BOOST_AUTO_TEST_CASE( metadata_cache_test )
+{
+  try
+  {
+    auto& meter = ctx.resource_meter();
+    ctx.invalidate_metadata_cache();
+
+    BOOST_TEST_MESSAGE( "Test cached metadata is charged as if it were read from state" );
+
+    auto start           = meter.compute_bandwidth_used();
+    auto resource_limits = chain::system_call::get_resource_limits( ctx );
+    auto uncached        = meter.compute_bandwidth_used() - start;
+
+    BOOST_REQUIRE( ctx.cached_metadata().resource_limits );
+
+    start       = meter.compute_bandwidth_used();
+    auto cached = chain::system_call::get_resource_limits( ctx );
+
+    BOOST_CHECK_EQUAL( meter.compute_bandwidth_used() - start, uncached );
+    BOOST_CHECK_EQUAL( cached.compute_bandwidth_limit(), resource_limits.compute_bandwidth_limit() );
+
+    BOOST_TEST_MESSAGE( "Test writing metadata invalidates the cache" );
+
+    resource_limits.set_compute_bandwidth_limit( resource_limits.compute_bandwidth_limit() + 1 );
+    chain::system_call::put_object( ctx,
+                                    chain::state::space::metadata(),
+                                    chain::state::key::resource_limit_data,
+                                    util::converter::as< std::string >( resource_limits ) );
+
+    BOOST_CHECK( !ctx.cached_metadata().resource_limits );
+    BOOST_CHECK_EQUAL( chain::system_call::get_resource_limits( ctx ).compute_bandwidth_limit(),
+                       resource_limits.compute_bandwidth_limit() );
+
+    BOOST_TEST_MESSAGE( "Test metadata written by a reverted transaction is not seen by the next one" );
+
+    auto block_node  = ctx.get_state_node();
+    auto parent_node = ctx.get_parent_node();
+
+    auto reverted_limits = resource_limits;
+    reverted_limits.set_compute_bandwidth_limit( resource_limits.compute_bandwidth_limit() + 1 );
+
+    ctx.set_state_node( block_node->create_anonymous_node(), parent_node );
+    chain::system_call::put_object( ctx,
+                                    chain::state::space::metadata(),
+                                    chain::state::key::resource_limit_data,
+                                    util::converter::as< std::string >( reverted_limits ) );
+    BOOST_CHECK_EQUAL( chain::system_call::get_resource_limits( ctx ).compute_bandwidth_limit(),
+                       reverted_limits.compute_bandwidth_limit() );
+    BOOST_REQUIRE( ctx.cached_metadata().resource_limits );
+
+    // The transaction node is discarded without being committed, as it is when a transaction reverts
+    ctx.set_state_node( block_node, parent_node );
+
+    ctx.set_state_node( block_node->create_anonymous_node(), parent_node );
+    BOOST_CHECK_EQUAL( chain::system_call::get_resource_limits( ctx ).compute_bandwidth_limit(),
+                       resource_limits.compute_bandwidth_limit() );
+    ctx.set_state_node( block_node, parent_node );
+    BOOST_CHECK_EQUAL( chain::system_call::get_resource_limits( ctx ).compute_bandwidth_limit(),
+                       resource_limits.compute_bandwidth_limit() );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( execution_context_pool_test )
+{
+  try
+  {
+    chain::execution_context* reused = nullptr;
+
+    BOOST_TEST_MESSAGE( "Test a released context is reused" );
+
+    {
+      auto pooled = chain::execution_context_pool::acquire( vm_backend, chain::intent::block_application );
+      reused      = pooled.get();
+
+      pooled->push_frame( chain::stack_frame{ .call_privilege = chain::privilege::kernel_mode } );
+      pooled->set_state_node( ctx.get_state_node() );
+      pooled->receipt() = protocol::block_receipt();
+      pooled->resource_meter().use_compute_bandwidth( 100 );
+      pooled->add_failed_transaction_index( 1 );
+    }
+
+    auto pooled = chain::execution_context_pool::acquire( vm_backend );
+    BOOST_CHECK_EQUAL( pooled.get(), reused );
+
+    BOOST_TEST_MESSAGE( "Test nothing from the previous use is visible" );
+
+    BOOST_CHECK( pooled->intent() == chain::intent::read_only );
+    BOOST_CHECK( !pooled->get_state_node() );
+    BOOST_CHECK( std::holds_alternative< std::monostate >( pooled->receipt() ) );
+    BOOST_CHECK_EQUAL( pooled->resource_meter().compute_bandwidth_used(), 0 );
+    BOOST_CHECK( pooled->get_failed_transaction_indices().empty() );
+    BOOST_CHECK_THROW( pooled->pop_frame(), chain::internal_error_exception );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
 BOOST_AUTO_TEST_CASE( system_resources )
 {
   try
@@ -2445,6 +2650,151 @@ BOOST_AUTO_TEST_CASE( syscall_override_return )
   KOINOS_CATCH_LOG_AND_RETHROW( info )
 }
 
+BOOST_AUTO_TEST_CASE( thunk_dispatcher_lookup )
+{
+  try
+  {
+    auto& dispatcher = const_cast< chain::thunk_dispatcher& >( chain::thunk_dispatcher::instance() );
+
+    const auto table_id        = chain::thunk_dispatcher::max_table_thunk_id - 1;
+    const auto map_id          = chain::thunk_dispatcher::max_table_thunk_id + 1;
+    const auto get_contract_id = static_cast< uint32_t >( chain::system_call_id::get_contract_id );
+    const auto nop             = static_cast< uint32_t >( chain::system_call_id::nop );
+
+    BOOST_TEST_MESSAGE( "Checking registered thunks and genesis flags" );
+
+    BOOST_CHECK( dispatcher.thunk_exists( get_contract_id ) );
+    BOOST_CHECK( dispatcher.thunk_is_genesis( get_contract_id ) );
+    BOOST_CHECK( dispatcher.thunk_exists( nop ) );
+    BOOST_CHECK( !dispatcher.thunk_is_genesis( nop ) );
+
+    BOOST_TEST_MESSAGE( "Checking unknown thunks" );
+
+    for( uint32_t id: { table_id, map_id, chain::thunk_dispatcher::max_table_thunk_id, ~uint32_t( 0 ) } )
+    {
+      BOOST_CHECK( !dispatcher.thunk_exists( id ) );
+      BOOST_CHECK( !dispatcher.thunk_is_genesis( id ) );
+      KOINOS_CHECK_THROW( dispatcher.call_thunk< chain::get_contract_id_result >( id, ctx ), chain::unknown_thunk );
+    }
+
+    std::string args;
+    char ret_buf[ 100 ];
+    uint32_t bytes_written = 0;
+
+    KOINOS_CHECK_THROW(
+      dispatcher.call_thunk( map_id, ctx, ret_buf, sizeof( ret_buf ), args.data(), 0, &bytes_written ),
+      chain::unknown_thunk );
+
+    BOOST_TEST_MESSAGE( "Registering thunks either side of the table" );
+
+    dispatcher.register_thunk< chain::get_contract_id_arguments, chain::get_contract_id_result >(
+      table_id,
+      chain::thunk::_get_contract_id );
+    dispatcher.register_genesis_thunk< chain::get_contract_id_arguments, chain::get_contract_id_result >(
+      map_id,
+      chain::thunk::_get_contract_id );
+
+    BOOST_CHECK( dispatcher.thunk_exists( table_id ) );
+    BOOST_CHECK( !dispatcher.thunk_is_genesis( table_id ) );
+    BOOST_CHECK( dispatcher.thunk_exists( map_id ) );
+    BOOST_CHECK( dispatcher.thunk_is_genesis( map_id ) );
+    BOOST_CHECK( !dispatcher.thunk_exists( chain::thunk_dispatcher::max_table_thunk_id ) );
+    BOOST_CHECK( !dispatcher.thunk_exists( map_id + 1 ) );
+
+    BOOST_TEST_MESSAGE( "Calling the registered thunks" );
+
+    for( uint32_t id: { table_id, map_id } )
+    {
+      BOOST_CHECK_EQUAL( dispatcher.call_thunk< chain::get_contract_id_result >( id, ctx ).value(),
+                         ctx.get_contract_id() );
+
+      bytes_written = 0;
+      dispatcher.call_thunk( id, ctx, ret_buf, sizeof( ret_buf ), args.data(), 0, &bytes_written );
+      BOOST_CHECK_EQUAL(
+        util::converter::to< chain::get_contract_id_result >( std::string( ret_buf, bytes_written ) ).value(),
+        ctx.get_contract_id() );
+    }
+
+    BOOST_TEST_MESSAGE( "Calling a thunk with the wrong signature" );
+
+    BOOST_CHECK_THROW( dispatcher.call_thunk< chain::get_caller_result >( map_id, ctx ), std::bad_any_cast );
+    BOOST_CHECK_THROW( dispatcher.call_thunk< void >( table_id, ctx ), std::bad_any_cast );
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
+BOOST_AUTO_TEST_CASE( verify_merkle_root_compute )
+{
+  try
+  {
+    auto resource_limits = chain::system_call::get_resource_limits( ctx );
+
+    auto thunk_compute        = ctx.get_thunk_compute_bandwidth( chain::system_call_id::verify_merkle_root );
+    auto deserialize_base     = ctx.get_compute_bandwidth( chain::compute_cost::deserialize_multihash_base );
+    auto deserialize_per_byte = ctx.get_compute_bandwidth( chain::compute_cost::deserialize_multihash_per_byte );
+    auto hash_base            = ctx.get_compute_bandwidth( chain::compute_cost::sha2_256_base );
+    auto hash_per_byte        = ctx.get_compute_bandwidth( chain::compute_cost::sha2_256_per_byte );
+
+    // Transactions in the block and the number of hashes charged for their leaves
+    const std::vector< std::pair< std::size_t, uint64_t > > blocks = {
+      {     1,      1},
+      {    10,     21},
+      {   100,    202},
+      { 1'000,  2'001},
+      {10'000, 20'005}
+    };
+
+    for( const auto& [ num_transactions, num_hashes ]: blocks )
+    {
+      // Each transaction contributes a header and a signatures leaf, as in apply_block
+      std::vector< crypto::multihash > leaves;
+      std::vector< std::string > hashes;
+      leaves.reserve( num_transactions * 2 );
+      hashes.reserve( num_transactions * 2 );
+
+      for( std::size_t i = 0; i < num_transactions * 2; i++ )
+      {
+        leaves.emplace_back( crypto::hash( crypto::multicodec::sha2_256, std::to_string( i ) ) );
+        hashes.emplace_back( util::converter::as< std::string >( leaves.back() ) );
+      }
+
+      auto root = util::converter::as< std::string >(
+        crypto::merkle_tree( crypto::multicodec::sha2_256, leaves ).root()->hash() );
+
+      auto expected_compute = thunk_compute
+                              + ( hashes.size() + 1 ) * ( deserialize_base + root.size() * deserialize_per_byte )
+                              + num_hashes * ( hash_base + 2 * 32 * hash_per_byte );
+
+      auto verify = [ & ]( const std::vector< std::string >& h )
+      {
+        ctx.resource_meter().set_resource_limit_data( resource_limits );
+        auto start   = ctx.resource_meter().compute_bandwidth_used();
+        auto matches = chain::system_call::verify_merkle_root( ctx, root, h );
+        BOOST_CHECK_EQUAL( ctx.resource_meter().compute_bandwidth_used() - start, expected_compute );
+        return matches;
+      };
+
+      BOOST_TEST_MESSAGE( "Checking verify_merkle_root over " << num_transactions << " transactions" );
+
+      BOOST_CHECK( verify( hashes ) );
+
+      auto altered   = hashes;
+      altered.back() = util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_256, "altered"s ) );
+      BOOST_CHECK( !verify( altered ) );
+
+      auto reordered = hashes;
+      std::swap( reordered.front(), reordered.back() );
+      BOOST_CHECK( !verify( reordered ) );
+
+      auto mismatched   = hashes;
+      mismatched.back() = util::converter::as< std::string >( crypto::hash( crypto::multicodec::sha2_512, "leaf"s ) );
+      KOINOS_REQUIRE_THROW( chain::system_call::verify_merkle_root( ctx, root, mismatched ),
+                            koinos::chain::unknown_hash_code );
+    }
+  }
+  KOINOS_CATCH_LOG_AND_RETHROW( info )
+}
+
 #define THUNK_TIME_PRINT_STATS false
 
 BOOST_AUTO_TEST_CASE( thunk_time )